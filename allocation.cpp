@@ -0,0 +1,123 @@
+#include "allocation.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include <malloc.h>
+
+namespace {
+thread_local AllocationStatistics* CurrentStatistics = nullptr;
+
+void recordAllocation(void* pointer, std::size_t size) noexcept {
+    if ( auto statistics = CurrentStatistics ) {
+        ++statistics->Allocations;
+        statistics->Bytes         += size;
+        statistics->LiveBytes     += static_cast<std::int64_t>(::malloc_usable_size(pointer));
+        statistics->PeakLiveBytes  = std::max(statistics->PeakLiveBytes, statistics->LiveBytes);
+    } //if ( auto statistics = CurrentStatistics )
+    return;
+}
+
+void* allocate(std::size_t size) {
+    //malloc(0) darf nullptr liefern, new muss aber einen eindeutigen Zeiger liefern.
+    auto ret = std::malloc(std::max(size, 1uz));
+    if ( !ret ) {
+        throw std::bad_alloc{};
+    } //if ( !ret )
+
+    recordAllocation(ret, size);
+    return ret;
+}
+
+void* allocate(std::size_t size, std::align_val_t alignment) {
+    const auto align = static_cast<std::size_t>(alignment);
+    //aligned_alloc will ein Vielfaches der Ausrichtung.
+    auto       ret   = std::aligned_alloc(align, (std::max(size, 1uz) + align - 1) / align * align);
+    if ( !ret ) {
+        throw std::bad_alloc{};
+    } //if ( !ret )
+
+    recordAllocation(ret, size);
+    return ret;
+}
+
+void deallocate(void* pointer) noexcept {
+    if ( !pointer ) {
+        return;
+    } //if ( !pointer )
+
+    if ( auto statistics = CurrentStatistics ) {
+        statistics->LiveBytes -= static_cast<std::int64_t>(::malloc_usable_size(pointer));
+    } //if ( auto statistics = CurrentStatistics )
+    std::free(pointer);
+    return;
+}
+} //namespace
+
+ScopedAllocationTracking::ScopedAllocationTracking(AllocationStatistics& statistics) noexcept :
+        Previous{std::exchange(CurrentStatistics, &statistics)} {
+    return;
+}
+
+ScopedAllocationTracking::~ScopedAllocationTracking(void) {
+    CurrentStatistics = Previous;
+    return;
+}
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete[](void* pointer) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    deallocate(pointer);
+    return;
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    deallocate(pointer);
+    return;
+}
@@ -0,0 +1,37 @@
+#ifndef ALLOCATION_HPP
+#define ALLOCATION_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Was zwischen Start und Ende einer Messung über operator new angefordert wurde.
+ *
+ * Die Live-Bytes werden über malloc_usable_size gezählt, sind also die tatsächlich belegten Blöcke, nicht die
+ * angeforderte Größe.
+ */
+struct AllocationStatistics {
+    std::uint64_t Allocations   = 0;
+    std::uint64_t Bytes         = 0;
+    std::int64_t  LiveBytes     = 0;
+    std::int64_t  PeakLiveBytes = 0;
+};
+
+/**
+ * @brief Zählt alle Allokationen des aktuellen Threads, solange das Objekt lebt.
+ *
+ * Ohne aktive Messung kostet der ersetzte operator new nur den Zugriff auf eine thread_local Variable. Threads die
+ * innerhalb der Messung gestartet werden, werden nicht mitgezählt.
+ */
+class ScopedAllocationTracking {
+    public:
+    explicit ScopedAllocationTracking(AllocationStatistics& statistics) noexcept;
+    ~ScopedAllocationTracking(void);
+
+    ScopedAllocationTracking(const ScopedAllocationTracking&)            = delete;
+    ScopedAllocationTracking& operator=(const ScopedAllocationTracking&) = delete;
+
+    private:
+    AllocationStatistics* Previous;
+};
+
+#endif //ALLOCATION_HPP
@@ -0,0 +1,202 @@
+#include "answers.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+/**
+ * @brief Liest genau das Format, das AnswerManifest::save schreibt, mit beliebigen Leerzeichen dazwischen.
+ */
+class ManifestParser {
+    public:
+    explicit ManifestParser(std::string_view text) noexcept : Text{text} {
+        return;
+    }
+
+    std::map<std::uint64_t, Answers> parse(void) {
+        std::map<std::uint64_t, Answers> ret;
+        expect('{');
+        if ( !consume('}') ) {
+            do {
+                const auto key = string();
+                expect(':');
+                ret[hash(key)] = answers();
+            } while ( consume(',') );
+            expect('}');
+        } //if ( !consume('}') )
+
+        skipWhitespace();
+        throwIfInvalid(Text.empty(), "Trailing data in answer manifest");
+        return ret;
+    }
+
+    private:
+    std::string_view Text;
+
+    void skipWhitespace(void) noexcept {
+        while ( !Text.empty() && std::isspace(static_cast<unsigned char>(Text.front())) ) {
+            Text.remove_prefix(1);
+        } //while ( !Text.empty() && std::isspace(static_cast<unsigned char>(Text.front())) )
+        return;
+    }
+
+    bool consume(char c) noexcept {
+        skipWhitespace();
+        if ( !Text.empty() && Text.front() == c ) {
+            Text.remove_prefix(1);
+            return true;
+        } //if ( !Text.empty() && Text.front() == c )
+        return false;
+    }
+
+    void expect(char c) {
+        throwIfInvalid(consume(c), "Malformed answer manifest");
+        return;
+    }
+
+    std::string_view string(void) {
+        expect('"');
+        const auto end = Text.find('"');
+        throwIfInvalid(end != std::string_view::npos, "Unterminated string in answer manifest");
+        const auto ret = Text.substr(0, end);
+        Text.remove_prefix(end + 1);
+        return ret;
+    }
+
+    static std::uint64_t hash(std::string_view key) {
+        //Über 2^63, das kann convert nicht.
+        std::uint64_t ret    = 0;
+        const auto    result = std::from_chars(key.data(), key.data() + key.size(), ret, 16);
+        throwIfInvalid(result.ec == std::errc{} && result.ptr == key.data() + key.size() && !key.empty(),
+                       "Invalid hash in answer manifest");
+        return ret;
+    }
+
+    std::optional<std::int64_t> number(void) {
+        skipWhitespace();
+        if ( Text.starts_with("null") ) {
+            Text.remove_prefix(4);
+            return std::nullopt;
+        } //if ( Text.starts_with("null") )
+
+        const auto end = Text.find_first_of(",} \t\r\n");
+        const auto ret = convert(Text.substr(0, end));
+        Text.remove_prefix(std::min(end, Text.size()));
+        return ret;
+    }
+
+    Answers answers(void) {
+        Answers ret;
+        expect('{');
+        do {
+            const auto key = string();
+            expect(':');
+            const auto value = number();
+
+            if ( key == "challenge" ) {
+                throwIfInvalid(!!value, "Challenge missing in answer manifest");
+                ret.Challenge = *value;
+            } //if ( key == "challenge" )
+            else if ( key == "part1" ) {
+                ret.Part1 = value;
+            } //else if ( key == "part1" )
+            else if ( key == "part2" ) {
+                ret.Part2 = value;
+            } //else if ( key == "part2" )
+        } while ( consume(',') );
+        expect('}');
+        return ret;
+    }
+};
+
+std::string toJson(const std::optional<std::int64_t>& value) {
+    return value ? std::format("{:d}", *value) : "null";
+}
+} //namespace
+
+std::uint64_t hashInput(std::string_view content) noexcept {
+    std::uint64_t ret = 0xcbf2'9ce4'8422'2325;
+    for ( char c : content ) {
+        ret ^= static_cast<unsigned char>(c);
+        ret *= 0x100'0000'01b3;
+    } //for ( char c : content )
+    return ret;
+}
+
+AnswerManifest AnswerManifest::load(const std::filesystem::path& path) {
+    AnswerManifest ret;
+    if ( !std::filesystem::exists(path) ) {
+        return ret;
+    } //if ( !std::filesystem::exists(path) )
+
+    std::ifstream file{path};
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( !file )
+
+    std::stringstream content;
+    content << file.rdbuf();
+    ret.Entries = ManifestParser{content.view()}.parse();
+    return ret;
+}
+
+void AnswerManifest::save(const std::filesystem::path& path) const {
+    std::ofstream file{path};
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( !file )
+
+    std::ostream_iterator<char> out{file};
+    std::format_to(out, "{{");
+    bool first = true;
+    for ( const auto& [hash, answers] : Entries ) {
+        std::format_to(out, "{:s}\n  \"{:016x}\": {{\"challenge\": {:d}, \"part1\": {:s}, \"part2\": {:s}}}",
+                       first ? "" : ",", hash, answers.Challenge, toJson(answers.Part1), toJson(answers.Part2));
+        first = false;
+    } //for ( const auto& [hash, answers] : Entries )
+    std::format_to(out, "\n}}\n");
+    return;
+}
+
+const Answers* AnswerManifest::find(std::uint64_t hash) const noexcept {
+    const auto iter = Entries.find(hash);
+    return iter == Entries.end() ? nullptr : &iter->second;
+}
+
+std::optional<bool> AnswerManifest::check(std::uint64_t hash, const Answers& results) const noexcept {
+    const auto expected = find(hash);
+    if ( !expected || expected->Challenge != results.Challenge ) {
+        return std::nullopt;
+    } //if ( !expected || expected->Challenge != results.Challenge )
+
+    const auto matches = [](const std::optional<std::int64_t>& expectedPart,
+                            const std::optional<std::int64_t>& resultPart) noexcept {
+        return !expectedPart || !resultPart || *expectedPart == *resultPart;
+    };
+    return matches(expected->Part1, results.Part1) && matches(expected->Part2, results.Part2);
+}
+
+void AnswerManifest::record(std::uint64_t hash, const Answers& answers) {
+    auto& entry = Entries[hash];
+    if ( entry.Challenge != answers.Challenge ) {
+        entry = {answers.Challenge, std::nullopt, std::nullopt};
+    } //if ( entry.Challenge != answers.Challenge )
+
+    //Mit --part wird nur ein Teil berechnet, der andere bleibt wie er war.
+    if ( answers.Part1 ) {
+        entry.Part1 = answers.Part1;
+    } //if ( answers.Part1 )
+    if ( answers.Part2 ) {
+        entry.Part2 = answers.Part2;
+    } //if ( answers.Part2 )
+    return;
+}
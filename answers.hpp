@@ -0,0 +1,61 @@
+#ifndef ANSWERS_HPP
+#define ANSWERS_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief Die richtigen Ergebnisse für eine Eingabe, ein fehlender Teil wird nicht geprüft.
+ */
+struct Answers {
+    std::int64_t                Challenge = 0;
+    std::optional<std::int64_t> Part1;
+    std::optional<std::int64_t> Part2;
+};
+
+/**
+ * @brief Der Hash über den Inhalt einer Eingabe, unter dem die Ergebnisse abgelegt werden (FNV-1a, 64 Bit).
+ */
+std::uint64_t hashInput(std::string_view content) noexcept;
+
+/**
+ * @brief Die Ergebnisse für beliebig viele Eingaben, gespeichert als JSON Objekt mit dem Hash als Schlüssel:
+ * {"0123456789abcdef": {"challenge": 1, "part1": 123, "part2": 456}}
+ */
+class AnswerManifest {
+    public:
+    /**
+     * @brief Lädt das Manifest, gibt es die Datei nicht, ist es leer. Wirft bei ungültigem Inhalt.
+     */
+    static AnswerManifest load(const std::filesystem::path& path);
+
+    /**
+     * @brief Schreibt das Manifest, sortiert nach Hash.
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @return Die Ergebnisse oder nullptr, wenn es für die Eingabe keine gibt.
+     */
+    const Answers* find(std::uint64_t hash) const noexcept;
+
+    /**
+     * @brief Vergleicht die Ergebnisse mit den bekannten, Teile die auf einer Seite fehlen, werden nicht verglichen.
+     * @return Ob die Ergebnisse stimmen, nullopt wenn es für die Eingabe keine bekannten Ergebnisse gibt.
+     */
+    std::optional<bool> check(std::uint64_t hash, const Answers& results) const noexcept;
+
+    /**
+     * @brief Fügt die Ergebnisse hinzu oder ersetzt sie, nur für die berechneten Teile. Gehört der Hash bisher zu
+     * einer anderen Challenge, wird der Eintrag ganz ersetzt.
+     */
+    void record(std::uint64_t hash, const Answers& answers);
+
+    private:
+    std::map<std::uint64_t, Answers> Entries;
+};
+
+#endif //ANSWERS_HPP
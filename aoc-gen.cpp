@@ -0,0 +1,76 @@
+#include "generator.hpp"
+#include "helper.hpp"
+#include "print.hpp"
+
+#include <cstdio>
+#include <span>
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+namespace {
+std::int64_t toNumber(std::string_view text) noexcept {
+    try {
+        return convert(text);
+    } //try
+    catch ( ... ) {
+        return 0;
+    }
+}
+} //namespace
+
+/**
+ * @brief Erzeugt eine Eingabe für eine Challenge und schreibt sie nach stdout.
+ *
+ * Aufruf: aoc-gen challenge [--scale K] [--seed S]
+ *
+ * Die richtigen Ergebnisse für die Eingabe liefert advent-of-code-2023 --reference.
+ * @result 0 bei Erfolg.
+ */
+int main(int argc, const char* argv[]) {
+    std::span<const char*> arguments{argv + 1, argv + argc};
+
+    if ( arguments.empty() ) {
+        myErr("Usage: aoc-gen challenge [--scale K] [--seed S]\n");
+        return -1;
+    } //if ( arguments.empty() )
+
+    const auto challenge = toNumber(arguments.front());
+    const auto generator = findGenerator(challenge);
+    if ( !generator ) {
+        myErr("{:s} is not a valid challenge identifier!\n", arguments.front());
+        return -1;
+    } //if ( !generator )
+    arguments = arguments.subspan(1);
+
+    std::int64_t scale = 1;
+    std::int64_t seed  = challenge;
+    while ( arguments.size() >= 2 ) {
+        const std::string_view option{arguments[0]};
+        const std::string_view value{arguments[1]};
+        const auto             number = toNumber(value);
+        arguments                     = arguments.subspan(2);
+
+        if ( option == "--scale"sv && number >= 1 ) {
+            scale = number;
+        } //if ( option == "--scale"sv && number >= 1 )
+        else if ( option == "--seed"sv && (number != 0 || value == "0"sv) ) {
+            seed = number;
+        } //else if ( option == "--seed"sv && (number != 0 || value == "0"sv) )
+        else {
+            myErr("Invalid option {:s} {:s}!\n", option, value);
+            return -1;
+        } //else -> if ( option == "--scale"sv && number >= 1 )
+    } //while ( arguments.size() >= 2 )
+
+    if ( !arguments.empty() ) {
+        myErr("{:s} needs a value!\n", arguments.front());
+        return -1;
+    } //if ( !arguments.empty() )
+
+    Random      random{static_cast<std::uint64_t>(seed)};
+    std::string out;
+    generator(random, scale, out);
+    std::fwrite(out.data(), 1, out.size(), stdout);
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "batch.hpp"
+
+#include "answers.hpp"
+#include "input.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+std::string jsonString(std::string_view text) {
+    std::string ret = "\"";
+    for ( char c : text ) {
+        switch ( c ) {
+            case '"'  : ret += "\\\""; break;
+            case '\\' : ret += "\\\\"; break;
+            case '\n' : ret += "\\n"; break;
+            case '\t' : ret += "\\t"; break;
+            default   : {
+                if ( static_cast<unsigned char>(c) < 0x20 ) {
+                    std::format_to(std::back_inserter(ret), "\\u{:04x}", static_cast<unsigned char>(c));
+                } //if ( static_cast<unsigned char>(c) < 0x20 )
+                else {
+                    ret += c;
+                } //else -> if ( static_cast<unsigned char>(c) < 0x20 )
+                break;
+            } //default
+        } //switch ( c )
+    } //for ( char c : text )
+    ret += '"';
+    return ret;
+}
+
+std::string jsonNumber(const std::optional<std::int64_t>& number) {
+    return number ? std::format("{:d}", *number) : "null";
+}
+
+void solveStages(const Challenge& challenge, const InputFile& input, int part, BatchResult& result) {
+    result.InputHash      = hashInput(input.content());
+    const auto parseStart = Clock::now();
+    const auto parsed     = challenge.Parse(input.lines());
+    const auto parseEnd   = Clock::now();
+    result.ParseTime      = parseEnd - parseStart;
+
+    if ( part != 2 ) {
+        const auto start = Clock::now();
+        result.Part1     = challenge.Part1(parsed);
+        result.Part1Time = Clock::now() - start;
+    } //if ( part != 2 )
+    if ( part != 1 && challenge.Part2 ) {
+        const auto start = Clock::now();
+        result.Part2     = challenge.Part2(parsed);
+        result.Part2Time = Clock::now() - start;
+    } //if ( part != 1 && challenge.Part2 )
+    return;
+}
+
+/**
+ * @brief Ruft die Funktion auf und trägt eine Exception als Fehler ins Ergebnis ein.
+ */
+template<typename Function>
+BatchResult captureErrors(Function&& function) noexcept {
+    BatchResult ret;
+    try {
+        function(ret);
+    } //try
+    catch ( const std::exception& e ) {
+        ret.Error = e.what();
+    } //catch ( const std::exception& e )
+    catch ( ... ) {
+        ret.Error = "Unknown exception";
+    } //catch ( ... )
+    return ret;
+}
+} //namespace
+
+std::vector<std::filesystem::path> collectBatchInputs(const std::filesystem::path& path) {
+    std::vector<std::filesystem::path> ret;
+
+    if ( std::filesystem::is_directory(path) ) {
+        for ( const auto& entry : std::filesystem::directory_iterator{path} ) {
+            if ( entry.is_regular_file() ) {
+                ret.push_back(entry.path());
+            } //if ( entry.is_regular_file() )
+        } //for ( const auto& entry : std::filesystem::directory_iterator{path} )
+        std::ranges::sort(ret);
+        return ret;
+    } //if ( std::filesystem::is_directory(path) )
+
+    std::ifstream manifest{path};
+    if ( !manifest ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( !manifest )
+
+    const auto  base = path.parent_path();
+    std::string line;
+    while ( std::getline(manifest, line) ) {
+        if ( line.empty() ) {
+            continue;
+        } //if ( line.empty() )
+        std::filesystem::path input{line};
+        ret.push_back(input.is_absolute() ? std::move(input) : base / input);
+    } //while ( std::getline(manifest, line) )
+    return ret;
+}
+
+BatchResult solveInput(const Challenge& challenge, const InputFile& input, int part) noexcept {
+    return captureErrors([&](BatchResult& result) { solveStages(challenge, input, part, result); });
+}
+
+BatchResult solveBatchInput(const Challenge& challenge, const std::filesystem::path& input, int part) noexcept {
+    return captureErrors([&](BatchResult& result) {
+        result.Input = input;
+        solveStages(challenge, InputFile::load(input), part, result);
+        return;
+    });
+}
+
+std::string formatBatchResult(std::int64_t challenge, const BatchResult& result) {
+    return std::format("{{\"challenge\": {:d}, \"input\": {:s}, \"hash\": \"{:016x}\", \"part1\": {:s}, "
+                       "\"part2\": {:s}, \"correct\": {:s}, \"cached\": {}, \"parse_ns\": {:d}, \"part1_ns\": {:d}, "
+                       "\"part2_ns\": {:d}, \"error\": {:s}}}\n",
+                       challenge, result.Input.empty() ? "null" : jsonString(result.Input.native()), result.InputHash,
+                       jsonNumber(result.Part1), jsonNumber(result.Part2),
+                       result.Correct ? *result.Correct ? "true" : "false" : "null", result.Cached,
+                       result.ParseTime.count(), result.Part1Time.count(), result.Part2Time.count(),
+                       result.Error.empty() ? "null" : jsonString(result.Error));
+}
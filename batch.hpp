@@ -0,0 +1,59 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include "challenge.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+class InputFile;
+
+/**
+ * @brief Das Ergebnis einer Challenge für eine Eingabe aus dem Batch.
+ */
+struct BatchResult {
+    std::filesystem::path       Input;
+    std::uint64_t               InputHash = 0;
+    std::optional<std::int64_t> Part1;
+    std::optional<std::int64_t> Part2;
+    std::chrono::nanoseconds    ParseTime{};
+    std::chrono::nanoseconds    Part1Time{};
+    std::chrono::nanoseconds    Part2Time{};
+    //! Leer, wenn alles geklappt hat.
+    std::string                 Error;
+    //! Nur gesetzt, wenn die richtigen Ergebnisse bekannt sind.
+    std::optional<bool>         Correct;
+    //! Ob das Ergebnis aus dem Cache des Servers kommt, die Zeiten sind dann die der ersten Berechnung.
+    bool                        Cached = false;
+};
+
+/**
+ * @brief Sammelt die Eingaben für den Batch.
+ *
+ * Ein Verzeichnis liefert alle regulären Dateien darin, nach Namen sortiert. Eine Datei ist ein Manifest mit einem
+ * Pfad pro Zeile, relative Pfade beziehen sich auf das Verzeichnis des Manifests.
+ */
+std::vector<std::filesystem::path> collectBatchInputs(const std::filesystem::path& path);
+
+/**
+ * @brief Löst die Challenge für eine bereits geladene Eingabe, wirft keine Exceptions sondern trägt den Fehler ein.
+ * @param[in] part 0 für beide Teile, sonst nur der angegebene.
+ */
+BatchResult solveInput(const Challenge& challenge, const InputFile& input, int part) noexcept;
+
+/**
+ * @brief Lädt die Eingabe und löst die Challenge dafür, wirft keine Exceptions sondern trägt den Fehler ein.
+ * @param[in] part 0 für beide Teile, sonst nur der angegebene.
+ */
+BatchResult solveBatchInput(const Challenge& challenge, const std::filesystem::path& input, int part) noexcept;
+
+/**
+ * @brief Formatiert das Ergebnis als eine JSON Zeile, inklusive Zeilenumbruch.
+ */
+std::string formatBatchResult(std::int64_t challenge, const BatchResult& result);
+
+#endif //BATCH_HPP
@@ -0,0 +1,135 @@
+#include "challenge16.hpp"
+#include "checker.hpp"
+#include "helper.hpp"
+#include "print.hpp"
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace {
+/**
+ * @brief Verfolgt einen Strahl Feld für Feld, ohne Graph und ohne Abschnitte.
+ * @param[in] direction Oben, rechts, unten, links.
+ */
+std::int64_t referenceEnergize(const std::vector<std::string_view>& map, std::size_t row, std::size_t column,
+                               std::size_t direction) {
+    constexpr std::array<std::ptrdiff_t, 4> rowDeltas{-1, 0, 1, 0};
+    constexpr std::array<std::ptrdiff_t, 4> columnDeltas{0, 1, 0, -1};
+
+    using Beam = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+    const auto                       rows    = map.size();
+    const auto                       columns = map.front().size();
+    std::vector<std::array<bool, 4>> seen(rows * columns);
+    std::vector<Beam>                beams{{row, column, direction}};
+    while ( !beams.empty() ) {
+        auto [r, c, d] = beams.back();
+        beams.pop_back();
+        //Über den Rand nach oben oder links wird die Zeile oder Spalte sehr groß und fällt damit auch raus.
+        while ( r < rows && c < columns && !seen[r * columns + c][d] ) {
+            seen[r * columns + c][d] = true;
+            switch ( map[r][c] ) {
+                case '/'  : d = std::array<std::size_t, 4>{1, 0, 3, 2}[d]; break;
+                case '\\' : d = std::array<std::size_t, 4>{3, 2, 1, 0}[d]; break;
+                case '|'  : {
+                    if ( d % 2 == 1 ) {
+                        beams.emplace_back(r + 1, c, 2);
+                        d = 0;
+                    } //if ( d % 2 == 1 )
+                    break;
+                } //case '|'
+                case '-'  : {
+                    if ( d % 2 == 0 ) {
+                        beams.emplace_back(r, c + 1, 1);
+                        d = 3;
+                    } //if ( d % 2 == 0 )
+                    break;
+                } //case '-'
+            } //switch ( map[r][c] )
+            r = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(r) + rowDeltas[d]);
+            c = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(c) + columnDeltas[d]);
+        } //while ( r < rows && c < columns && !seen[r * columns + c][d] )
+    } //while ( !beams.empty() )
+    return std::ranges::count_if(seen, [](const std::array<bool, 4>& directions) noexcept {
+        return std::ranges::any_of(directions, std::identity{});
+    });
+}
+
+std::int64_t referenceSweep(const std::vector<std::string_view>& map) {
+    const auto   rows    = map.size();
+    const auto   columns = map.front().size();
+    std::int64_t ret     = 0;
+    for ( std::size_t column = 0; column < columns; ++column ) {
+        ret = std::max({ret, referenceEnergize(map, 0, column, 2), referenceEnergize(map, rows - 1, column, 0)});
+    } //for ( std::size_t column = 0; column < columns; ++column )
+    for ( std::size_t row = 0; row < rows; ++row ) {
+        ret = std::max({ret, referenceEnergize(map, row, 0, 1), referenceEnergize(map, row, columns - 1, 3)});
+    } //for ( std::size_t row = 0; row < rows; ++row )
+    return ret;
+}
+
+/**
+ * @brief Der Graph, jeder Startpunkt einzeln und die Challenge selbst gegen referenceSweep.
+ */
+void checkGeneratedMap(Checker& checker, ThreadPool& pool, std::uint64_t seed, std::int64_t scale) {
+    Random      random{seed};
+    std::string input;
+    const auto  map       = generateMap(16, random, scale, input);
+    const auto  expected  = referenceSweep(map);
+    const auto  graph     = sweepEdges(map, &pool);
+    const auto  each      = sweepEdges(map, &pool, 0);
+    const auto& challenge = challenge16();
+
+    checker.expect(std::format("Map {:d}x{:d}, graph", seed, scale), graph.MaxEnergized, expected);
+    checker.expect(std::format("Map {:d}x{:d}, graph used", seed, scale), graph.UsedBeamGraph, true);
+    checker.expect(std::format("Map {:d}x{:d}, each start", seed, scale), each.MaxEnergized, expected);
+    checker.expect(std::format("Map {:d}x{:d}, part 2", seed, scale), challenge.Part2(challenge.Parse(map)),
+                   expected);
+    return;
+}
+
+/**
+ * @brief Auf einer großen Karte muss der Graph reichen, sonst dauert es pro Startpunkt die ganze Karte.
+ */
+void checkLargeMap(Checker& checker, std::int64_t scale) {
+    Random      random{1};
+    std::string input;
+    const auto  map   = generateMap(16, random, scale, input);
+    const auto  start = std::chrono::steady_clock::now();
+    const auto  sweep = sweepEdges(map, nullptr);
+    const auto  end   = std::chrono::steady_clock::now();
+    myPrint("{:d}x{:d}: {:d} energized in {}\n", map.size(), map.front().size(), sweep.MaxEnergized,
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start));
+    checker.expect(std::format("Large map x{:d}, graph used", scale), sweep.UsedBeamGraph, true);
+    return;
+}
+} //namespace
+
+/**
+ * @brief Prüft Teil 2 von Challenge 16 gegen einen schlichten Strahl pro Startpunkt, mit dem Graphen und ohne. Auf
+ * einer großen Karte muss der Graph genommen werden.
+ *
+ * Aufruf: beam-check [maps] [large scale]
+ * @return 0, wenn jeder Weg die Referenz trifft und die große Karte über den Graphen läuft.
+ */
+int main(int argc, const char* argv[]) {
+    const auto maps       = argc > 1 ? convert(argv[1]) : 3;
+    const auto largeScale = argc > 2 ? convert(argv[2]) : 10;
+
+    Checker    checker;
+    ThreadPool pool{4};
+    for ( std::int64_t seed = 1; seed <= maps; ++seed ) {
+        checkGeneratedMap(checker, pool, static_cast<std::uint64_t>(seed), 1 + (seed - 1) % 3);
+    } //for ( std::int64_t seed = 1; seed <= maps; ++seed )
+    checkLargeMap(checker, largeScale);
+    return checker.finish();
+}
@@ -0,0 +1,82 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+
+namespace {
+std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds>& sortedSamples, double p) noexcept {
+    const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sortedSamples.size())));
+    return sortedSamples[std::clamp(rank, 1uz, sortedSamples.size()) - 1];
+}
+} //namespace
+
+BenchmarkStatistics calculateStatistics(std::vector<std::chrono::nanoseconds> samples) {
+    BenchmarkStatistics ret;
+    ret.Runs = samples.size();
+    if ( samples.empty() ) {
+        return ret;
+    } //if ( samples.empty() )
+
+    std::ranges::sort(samples);
+    ret.Min    = samples.front();
+    ret.Max    = samples.back();
+    ret.Median = percentile(samples, .5);
+    ret.P90    = percentile(samples, .9);
+    ret.P99    = percentile(samples, .99);
+
+    const auto count    = static_cast<double>(samples.size());
+    const auto toDouble = [](std::chrono::nanoseconds ns) noexcept { return static_cast<double>(ns.count()); };
+    ret.Mean            = std::ranges::fold_left(samples | std::views::transform(toDouble), 0., std::plus<>{}) / count;
+
+    if ( samples.size() > 1 ) {
+        const auto squaredDeviation = [&ret, &toDouble](std::chrono::nanoseconds ns) noexcept {
+            const auto deviation = toDouble(ns) - ret.Mean;
+            return deviation * deviation;
+        };
+        ret.StdDev = std::sqrt(
+            std::ranges::fold_left(samples | std::views::transform(squaredDeviation), 0., std::plus<>{}) /
+            (count - 1));
+    } //if ( samples.size() > 1 )
+    return ret;
+}
+
+void writeBenchmarkReport(const std::filesystem::path& path, const std::vector<BenchmarkResult>& results) {
+    std::ofstream file{path};
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( !file )
+
+    std::ostream_iterator<char> out{file};
+
+    if ( path.extension() == ".csv" ) {
+        std::format_to(out, "challenge,successful,runs,min_ns,median_ns,p90_ns,p99_ns,max_ns,mean_ns,stddev_ns\n");
+        for ( const auto& result : results ) {
+            const auto& s = result.Statistics;
+            std::format_to(out, "{:d},{:d},{:d},{:d},{:d},{:d},{:d},{:d},{:.1f},{:.1f}\n", result.Challenge,
+                           result.Successful, s.Runs, s.Min.count(), s.Median.count(), s.P90.count(), s.P99.count(),
+                           s.Max.count(), s.Mean, s.StdDev);
+        } //for ( const auto& result : results )
+        return;
+    } //if ( path.extension() == ".csv" )
+
+    std::format_to(out, "{{\n  \"unit\": \"ns\",\n  \"challenges\": [");
+    bool first = true;
+    for ( const auto& result : results ) {
+        const auto& s = result.Statistics;
+        std::format_to(out,
+                       "{:s}\n    {{\"challenge\": {:d}, \"successful\": {}, \"runs\": {:d}, \"min\": {:d}, "
+                       "\"median\": {:d}, \"p90\": {:d}, \"p99\": {:d}, \"max\": {:d}, \"mean\": {:.1f}, "
+                       "\"stddev\": {:.1f}}}",
+                       first ? "" : ",", result.Challenge, result.Successful, s.Runs, s.Min.count(),
+                       s.Median.count(), s.P90.count(), s.P99.count(), s.Max.count(), s.Mean, s.StdDev);
+        first = false;
+    } //for ( const auto& result : results )
+    std::format_to(out, "\n  ]\n}}\n");
+    return;
+}
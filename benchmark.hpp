@@ -0,0 +1,36 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+struct BenchmarkStatistics {
+    std::size_t              Runs = 0;
+    std::chrono::nanoseconds Min{};
+    std::chrono::nanoseconds Median{};
+    std::chrono::nanoseconds P90{};
+    std::chrono::nanoseconds P99{};
+    std::chrono::nanoseconds Max{};
+    double                   Mean   = 0.;
+    double                   StdDev = 0.;
+};
+
+struct BenchmarkResult {
+    std::int64_t        Challenge  = 0;
+    bool                Successful = false;
+    BenchmarkStatistics Statistics;
+};
+
+/**
+ * @brief Berechnet die Statistik über die gemessenen Laufzeiten, die Perzentile nach dem Nearest-Rank Verfahren.
+ */
+BenchmarkStatistics calculateStatistics(std::vector<std::chrono::nanoseconds> samples);
+
+/**
+ * @brief Schreibt den Report, endet der Pfad auf .csv als CSV, sonst als JSON.
+ */
+void writeBenchmarkReport(const std::filesystem::path& path, const std::vector<BenchmarkResult>& results);
+
+#endif //BENCHMARK_HPP
@@ -0,0 +1,75 @@
+#ifndef CHALLENGE_HPP
+#define CHALLENGE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Das Ergebnis des Parsens, den Typ kennt nur die Challenge selbst.
+ */
+using ParsedInput = std::shared_ptr<void>;
+
+/**
+ * @brief Eine Challenge, aufgeteilt in das Parsen und die beiden Teile, damit man sie getrennt messen und aufrufen
+ * kann.
+ */
+struct Challenge {
+    int Number;
+    ParsedInput (*Parse)(const std::vector<std::string_view>& input);
+    std::int64_t (*Part1)(const ParsedInput& parsed);
+    //! Kann nullptr sein, wenn es keinen zweiten Teil gibt.
+    std::int64_t (*Part2)(const ParsedInput& parsed);
+    //! Die Ergebnisse für die mitgelieferte data/N.txt, sie gelten nur für eine Eingabe mit deren Hash.
+    std::int64_t ExpectedPart1;
+    std::int64_t ExpectedPart2;
+};
+
+namespace detail {
+template<auto ParseFunction>
+using ParsedType =
+    std::remove_cvref_t<std::invoke_result_t<decltype(ParseFunction), const std::vector<std::string_view>&>>;
+
+template<auto ParseFunction>
+ParsedInput parseStage(const std::vector<std::string_view>& input) {
+    return std::make_shared<ParsedType<ParseFunction>>(ParseFunction(input));
+}
+
+template<auto ParseFunction, auto PartFunction>
+std::int64_t partStage(const ParsedInput& parsed) {
+    return static_cast<std::int64_t>(PartFunction(*static_cast<ParsedType<ParseFunction>*>(parsed.get())));
+}
+} //namespace detail
+
+/**
+ * @brief Baut die Challenge aus den einzelnen Funktionen zusammen.
+ * @tparam ParseFunction Wandelt die Eingabe in beliebigen Typ T.
+ * @tparam Part1Function Berechnet Teil 1 aus T& oder const T&.
+ * @tparam Part2Function Berechnet Teil 2 aus T& oder const T&.
+ */
+template<auto ParseFunction, auto Part1Function, auto Part2Function>
+constexpr Challenge makeChallenge(int number, std::int64_t expectedPart1, std::int64_t expectedPart2) noexcept {
+    return {number,
+            detail::parseStage<ParseFunction>,
+            detail::partStage<ParseFunction, Part1Function>,
+            detail::partStage<ParseFunction, Part2Function>,
+            expectedPart1,
+            expectedPart2};
+}
+
+/**
+ * @brief Für die Challenges, die nur einen Teil haben.
+ */
+template<auto ParseFunction, auto Part1Function>
+constexpr Challenge makeChallenge(int number, std::int64_t expectedPart1) noexcept {
+    return {number,
+            detail::parseStage<ParseFunction>,
+            detail::partStage<ParseFunction, Part1Function>,
+            nullptr,
+            expectedPart1,
+            0};
+}
+
+#endif //CHALLENGE_HPP
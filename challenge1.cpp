@@ -1,10 +1,10 @@
 #include "challenge1.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <array>
+#include <format>
 #include <functional>
 #include <limits>
 #include <ranges>
@@ -69,16 +69,23 @@ int digifierWithStrings(std::string_view input) noexcept {
     const auto result         = static_cast<int>(firstDigit * 10 + lastDigit);
     return result;
 }
-} //namespace
 
-bool challenge1(const std::vector<std::string_view>& input) {
-    auto       digified1 = input | std::views::transform(digifier);
-    const auto sum1      = std::ranges::fold_left(digified1, 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+std::vector<std::string_view> parse(const std::vector<std::string_view>& input) {
+    return input;
+}
+
+std::int64_t part1(const std::vector<std::string_view>& input) {
+    auto digified = input | std::views::transform(digifier);
+    return std::ranges::fold_left(digified, 0, std::plus<>{});
+}
 
-    auto       digified2 = input | std::views::transform(digifierWithStrings);
-    const auto sum2      = std::ranges::fold_left(digified2, 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+std::int64_t part2(const std::vector<std::string_view>& input) {
+    auto digified = input | std::views::transform(digifierWithStrings);
+    return std::ranges::fold_left(digified, 0, std::plus<>{});
+}
+} //namespace
 
-    return sum1 == 54667 && sum2 == 54203;
+const Challenge& challenge1(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(1, 54667, 54203);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE1_HPP
 #define CHALLENGE1_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge1(const std::vector<std::string_view>& input);
+const Challenge& challenge1(void) noexcept;
 
 #endif //CHALLENGE1_HPP
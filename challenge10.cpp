@@ -1,8 +1,9 @@
 #include "challenge10.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
+#include <array>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 
@@ -126,12 +127,28 @@ auto findNeighbors(Map map, Coordinate start) {
     return std::pair{ret, directionFrom(direction)};
 }
 
-void move(Map map, MovingPosition& pos) {
-    auto previous = std::exchange(pos.Previous, pos.Current);
+/**
+ * @brief Ob die Röhre auf current dort eine Öffnung hat, wo wir von previous herkommen.
+ */
+bool connectsTo(PipeDirection pipe, Coordinate current, Coordinate previous) noexcept {
+    if ( previous.Row != current.Row ) {
+        return previous.Row < current.Row ? isNorth(pipe) : isSouth(pipe);
+    } //if ( previous.Row != current.Row )
+    return previous.Column < current.Column ? isWest(pipe) : isEast(pipe);
+}
+
+/**
+ * @brief Geht einen Schritt entlang der Röhre.
+ * @return Ob man auf einem Feld der Karte angekommen ist, dessen Röhre zurück zeigt. Sonst darf man nicht weiter
+ * laufen, die Prüfung übernimmt der Aufrufer, damit der Schritt selbst nichts wirft.
+ */
+bool move(Map map, MovingPosition& pos) noexcept {
+    const auto pipe     = static_cast<PipeDirection>(map[pos.Current.Row][pos.Current.Column]);
+    const auto previous = std::exchange(pos.Previous, pos.Current);
 
-    switch ( static_cast<PipeDirection>(map[pos.Current.Row][pos.Current.Column]) ) {
-        case Animal :
-        case Ground     : throwIfInvalid(false); break;
+    switch ( pipe ) {
+        case Animal     :
+        case Ground     : return false;
 
         case NorthSouth : pos.Current.Row += pos.Current.Row - previous.Row; break;
         case WestEast   : pos.Current.Column += pos.Current.Column - previous.Column; break;
@@ -175,8 +192,12 @@ void move(Map map, MovingPosition& pos) {
             } //else -> if ( pos.Current.Row == previous.Row )
             break;
         } //case SouthEast
-    } //switch ( static_cast<PipeDirection>(map[pos.Current.Row][pos.Current.Column]) )
-    return;
+    } //switch ( pipe )
+
+    //Das neue Feld muss in der Karte liegen (nach oben und links läuft der Index über) und zurück zeigen, sonst bleibt
+    //man bei einer falsch angeschlossenen Röhre stehen.
+    return pos.Current.Row < map.size() && pos.Current.Column < map[pos.Current.Row].size() &&
+           connectsTo(static_cast<PipeDirection>(map[pos.Current.Row][pos.Current.Column]), pos.Current, pos.Previous);
 }
 } //namespace
 
@@ -190,29 +211,62 @@ struct hash<Coordinate> {
 };
 } //namespace std
 
-bool challenge10(const std::vector<std::string_view>& input) {
-    const auto& map                              = input;
-    const auto  animalPosition                   = findAnimal(map);
-    const auto [startPositions, animalDirection] = findNeighbors(map, animalPosition);
+namespace {
+struct PipeMap {
+    std::vector<Row>               Rows;
+    Coordinate                     AnimalPosition;
+    std::array<Coordinate, 2>      StartPositions;
+    PipeDirection                  AnimalDirection;
+    //! Die Schritte bis zum entferntesten Punkt der Schleife.
+    std::int64_t                   FarthestSteps = 0;
+    std::unordered_set<Coordinate> PartOfLoop;
+};
+
+/**
+ * @brief Läuft die Schleife ab.
+ * @return Die Anzahl der Schritte bis zum entferntesten Punkt und alle Koordinaten der Schleife.
+ */
+std::pair<std::int64_t, std::unordered_set<Coordinate>> traceLoop(const PipeMap& pipeMap) {
+    const auto& map = pipeMap.Rows;
 
-    MovingPosition pos1{startPositions[0], animalPosition};
-    MovingPosition pos2{startPositions[1], animalPosition};
+    MovingPosition pos1{pipeMap.StartPositions[0], pipeMap.AnimalPosition};
+    MovingPosition pos2{pipeMap.StartPositions[1], pipeMap.AnimalPosition};
 
     std::unordered_set<Coordinate> partOfLoop;
-    partOfLoop.insert(animalPosition);
-    partOfLoop.insert(startPositions[0]);
-    partOfLoop.insert(startPositions[1]);
+    partOfLoop.insert(pipeMap.AnimalPosition);
+    partOfLoop.insert(pipeMap.StartPositions[0]);
+    partOfLoop.insert(pipeMap.StartPositions[1]);
 
     std::int64_t moves = 1;
     while ( pos1.Current != pos2.Current ) {
-        move(map, pos1);
-        move(map, pos2);
+        const bool valid = move(map, pos1) && move(map, pos2);
+        throwIfInvalid(valid);
         ++moves;
         partOfLoop.insert(pos1.Current);
         partOfLoop.insert(pos2.Current);
     } //while ( pos1.Current != pos2.Current )
 
-    myPrint(" == Result of Part 1: {:d} ==\n", moves);
+    return {moves, std::move(partOfLoop)};
+}
+
+/**
+ * @brief Beide Teile brauchen die Schleife, sie wird daher schon hier einmal abgelaufen.
+ */
+PipeMap parse(const std::vector<std::string_view>& input) {
+    PipeMap ret{input, findAnimal(input), {}, Ground, 0, {}};
+    std::tie(ret.StartPositions, ret.AnimalDirection) = findNeighbors(ret.Rows, ret.AnimalPosition);
+    std::tie(ret.FarthestSteps, ret.PartOfLoop)       = traceLoop(ret);
+    return ret;
+}
+
+std::int64_t part1(const PipeMap& pipeMap) noexcept {
+    return pipeMap.FarthestSteps;
+}
+
+std::int64_t part2(const PipeMap& pipeMap) {
+    const auto& map             = pipeMap.Rows;
+    const auto  animalDirection = pipeMap.AnimalDirection;
+    const auto& partOfLoop      = pipeMap.PartOfLoop;
 
     std::int64_t withinLoop = 0;
     for ( std::size_t row = 0; row < map.size(); ++row ) {
@@ -261,7 +315,11 @@ bool challenge10(const std::vector<std::string_view>& input) {
         throwIfInvalid(!within);
     } //for ( std::size_t row = 0; row < map.size(); ++row )
 
-    myPrint(" == Result of Part 2: {:d} ==\n", withinLoop);
+    return withinLoop;
+}
+} //namespace
 
-    return moves == 6786 && withinLoop == 495;
+const Challenge& challenge10(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(10, 6786, 495);
+    return challenge;
 }
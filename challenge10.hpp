@@ -1,9 +1,8 @@
 #ifndef CHALLENGE10_HPP
 #define CHALLENGE10_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge10(const std::vector<std::string_view>& input);
+const Challenge& challenge10(void) noexcept;
 
 #endif //CHALLENGE10_HPP
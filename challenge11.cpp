@@ -1,10 +1,9 @@
 #include "challenge11.hpp"
 
-#include "print.hpp"
-
 #include <algorithm>
 #include <cstdint>
 #include <cmath>
+#include <iterator>
 
 namespace {
 using Row = std::string_view;
@@ -70,41 +69,45 @@ struct hash<Coordinate> {
 };
 } //namespace std
 
-bool challenge11(const std::vector<std::string_view>& input) {
-    const auto& map               = input;
-    const auto  galaxyCoordinates = calcCoordinates(map);
-    const auto  emptyRows         = calcEmptyRows(map);
-    const auto  emptyColumns      = calcEmptyColumns(map);
-
-    std::vector<Coordinate> adaptedCoordinates(galaxyCoordinates);
-    auto                    updateAdapted = [&adaptedCoordinates, &galaxyCoordinates, &emptyColumns,
-                          &emptyRows](std::size_t factor) noexcept {
-        std::ranges::transform(galaxyCoordinates, adaptedCoordinates.begin(),
-                                                  [&emptyRows, &emptyColumns, factor](Coordinate c) noexcept {
-                                   c.Row    += emptyRows[c.Row] * (factor - 1);
-                                   c.Column += emptyColumns[c.Column] * (factor - 1);
-                                   return c;
-                               });
-    };
-    updateAdapted(2);
-
-    auto calcSum = [&adaptedCoordinates, end = adaptedCoordinates.end()](void) noexcept {
-        std::int64_t sum = 0;
-
-        for ( auto iter = adaptedCoordinates.begin(); iter != end; ++iter ) {
-            for ( auto nextIter = std::next(iter); nextIter != end; ++nextIter ) {
-                sum += calcDistance(*iter, *nextIter);
-            }
-        }
-        return sum;
-    };
-    const auto sum1 = calcSum();
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-
-    updateAdapted(1000000);
-    const auto sum2 = calcSum();
-
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-
-    return sum1 == 9648398 && sum2 == 618'800'410'814;
+namespace {
+struct Universe {
+    std::vector<Coordinate>  GalaxyCoordinates;
+    std::vector<std::size_t> EmptyRows;
+    std::vector<std::size_t> EmptyColumns;
+};
+
+Universe parse(const std::vector<std::string_view>& input) noexcept {
+    return {calcCoordinates(input), calcEmptyRows(input), calcEmptyColumns(input)};
+}
+
+std::int64_t calcSum(const Universe& universe, std::size_t factor) {
+    std::vector<Coordinate> adaptedCoordinates(universe.GalaxyCoordinates.size());
+    std::ranges::transform(universe.GalaxyCoordinates, adaptedCoordinates.begin(),
+                           [&universe, factor](Coordinate c) noexcept {
+                               c.Row    += universe.EmptyRows[c.Row] * (factor - 1);
+                               c.Column += universe.EmptyColumns[c.Column] * (factor - 1);
+                               return c;
+                           });
+
+    std::int64_t sum = 0;
+    for ( auto iter = adaptedCoordinates.begin(), end = adaptedCoordinates.end(); iter != end; ++iter ) {
+        for ( auto nextIter = std::next(iter); nextIter != end; ++nextIter ) {
+            sum += calcDistance(*iter, *nextIter);
+        } //for ( auto nextIter = std::next(iter); nextIter != end; ++nextIter )
+    } //for ( auto iter = adaptedCoordinates.begin(), end = adaptedCoordinates.end(); iter != end; ++iter )
+    return sum;
+}
+
+std::int64_t part1(const Universe& universe) {
+    return calcSum(universe, 2);
+}
+
+std::int64_t part2(const Universe& universe) {
+    return calcSum(universe, 1'000'000);
+}
+} //namespace
+
+const Challenge& challenge11(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(11, 9648398, 618'800'410'814);
+    return challenge;
 }
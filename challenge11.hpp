@@ -1,9 +1,8 @@
 #ifndef CHALLENGE11_HPP
 #define CHALLENGE11_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge11(const std::vector<std::string_view>& input);
+const Challenge& challenge11(void) noexcept;
 
 #endif //CHALLENGE11_HPP
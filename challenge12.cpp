@@ -1,7 +1,6 @@
 #include "challenge12.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -34,8 +33,6 @@ struct hash<Line> : hash<std::string> {
 } //namespace std
 
 namespace {
-std::unordered_map<Line, std::int64_t> Cache;
-
 auto parse(const std::vector<std::string_view>& input) {
     std::vector<Line> ret;
     for ( auto inputLine : input ) {
@@ -53,7 +50,7 @@ auto parse(const std::vector<std::string_view>& input) {
     return ret;
 }
 
-std::int64_t calcNumberOfArrengements(const Line& line) noexcept {
+std::int64_t calcNumberOfArrengements(const Line& line) {
     //Meine Lösung, dauert aber viel zu lange für Part 2
     static_assert(Damaged < Operational);
     std::vector<SpringInfo> inserts(static_cast<std::size_t>(line.NumberOfUnknown), Operational);
@@ -101,7 +98,7 @@ std::int64_t calcNumberOfArrengements(const Line& line) noexcept {
     return number;
 }
 
-Line unfold(const Line& line) noexcept {
+Line unfold(const Line& line) {
     Line ret;
     ret.Springs = std::format("{0:s}?{0:s}?{0:s}?{0:s}?{0:s}", line.Springs);
     ret.DamagedGroups.resize(line.DamagedGroups.size() * 5);
@@ -116,91 +113,93 @@ Line unfold(const Line& line) noexcept {
     return ret;
 }
 
-std::int64_t recurse(Line line) noexcept;
-
-std::int64_t calcRecurse(Line line) noexcept {
-    //Von https://pastebin.com/djb8RJ85 geklaut...
-    for ( ;; ) {
-        if ( line.DamagedGroups.empty() ) {
-            //Wir haben nichts mehr zu verteilen. Das passt, wenn es auch keine Damaged mehr gibt.
-            return line.Springs.contains(Damaged) ? 0 : 1;
-        } //if ( line.DamagedGroups.empty() )
-
-        if ( line.Springs.empty() ) {
-            //Keine Springs mehr, aber wür müssten noch kaputte verteilen.
-            return 0;
-        } //if ( line.Springs.empty() )
-
-        switch ( static_cast<SpringInfo>(line.Springs.front()) ) {
-            case Operational : {
-                auto pos = line.Springs.find_first_not_of(Operational);
-                line.Springs.erase(0, pos);
-                break;
-            } //case Operational
-
-            case Unknown : {
-                line.Springs.front() = Operational;
-                auto operational     = recurse(line);
-                line.Springs.front() = Damaged;
-                auto damaged         = recurse(line);
-                return operational + damaged;
-            } //case Unknown
-
-            case Damaged : {
-                const auto groupLength = static_cast<std::size_t>(line.DamagedGroups.front());
-                if ( line.Springs.size() < groupLength ) {
-                    //Passt nicht.
-                    return 0;
-                } //if ( line.Springs.size() < groupLength )
-
-                if ( std::ranges::contains(line.Springs | std::views::take(groupLength), Operational) ) {
-                    //Passt auch nicht.
-                    return 0;
-                } //if ( std::ranges::contains(line.Springs | std::views::take(groupLength), Operational) )
-
-                if ( line.DamagedGroups.size() > 1 ) {
-                    if ( line.Springs.size() < groupLength + 1 || line.Springs[groupLength] == Damaged ) {
-                        //Gruppe nicht abgeschlossen, oder nicht genug Platz für die nächste Gruppe.
+struct ArrangementCounter {
+    std::unordered_map<Line, std::int64_t> Cache;
+
+    std::int64_t recurse(Line line) {
+        const auto iter = Cache.find(line);
+        if ( iter != Cache.end() ) {
+            return iter->second;
+        } //if ( iter != Cache.end() )
+
+        auto result = calcRecurse(line);
+        Cache.emplace(std::move(line), result);
+        return result;
+    }
+
+    std::int64_t calcRecurse(Line line) {
+        //Von https://pastebin.com/djb8RJ85 geklaut...
+        for ( ;; ) {
+            if ( line.DamagedGroups.empty() ) {
+                //Wir haben nichts mehr zu verteilen. Das passt, wenn es auch keine Damaged mehr gibt.
+                return line.Springs.contains(Damaged) ? 0 : 1;
+            } //if ( line.DamagedGroups.empty() )
+
+            if ( line.Springs.empty() ) {
+                //Keine Springs mehr, aber wür müssten noch kaputte verteilen.
+                return 0;
+            } //if ( line.Springs.empty() )
+
+            switch ( static_cast<SpringInfo>(line.Springs.front()) ) {
+                case Operational : {
+                    auto pos = line.Springs.find_first_not_of(Operational);
+                    line.Springs.erase(0, pos);
+                    break;
+                } //case Operational
+
+                case Unknown : {
+                    line.Springs.front() = Operational;
+                    auto operational     = recurse(line);
+                    line.Springs.front() = Damaged;
+                    auto damaged         = recurse(line);
+                    return operational + damaged;
+                } //case Unknown
+
+                case Damaged : {
+                    const auto groupLength = static_cast<std::size_t>(line.DamagedGroups.front());
+                    if ( line.Springs.size() < groupLength ) {
+                        //Passt nicht.
+                        return 0;
+                    } //if ( line.Springs.size() < groupLength )
+
+                    if ( std::ranges::contains(line.Springs | std::views::take(groupLength), Operational) ) {
+                        //Passt auch nicht.
                         return 0;
-                    } //if ( line.Springs.size() < groupLength + 1 || line.Springs[groupLength] == Damaged )
+                    } //if ( std::ranges::contains(line.Springs | std::views::take(groupLength), Operational) )
+
+                    if ( line.DamagedGroups.size() > 1 ) {
+                        if ( line.Springs.size() < groupLength + 1 || line.Springs[groupLength] == Damaged ) {
+                            //Gruppe nicht abgeschlossen, oder nicht genug Platz für die nächste Gruppe.
+                            return 0;
+                        } //if ( line.Springs.size() < groupLength + 1 || line.Springs[groupLength] == Damaged )
 
-                    line.Springs.erase(0, groupLength + 1);
+                        line.Springs.erase(0, groupLength + 1);
+                        line.DamagedGroups.erase(line.DamagedGroups.begin());
+                        break;
+                    } //if ( line.DamagedGroups.size() > 1 )
+
+                    line.Springs.erase(0, groupLength);
                     line.DamagedGroups.erase(line.DamagedGroups.begin());
                     break;
-                } //if ( line.DamagedGroups.size() > 1 )
-
-                line.Springs.erase(0, groupLength);
-                line.DamagedGroups.erase(line.DamagedGroups.begin());
-                break;
-            } //case Damaged
-        } //switch ( static_cast<SpringInfo>(line.Springs.front()) )
-    } //for ( ;; )
-}
+                } //case Damaged
+            } //switch ( static_cast<SpringInfo>(line.Springs.front()) )
+        } //for ( ;; )
+    }
+};
 
-std::int64_t recurse(Line line) noexcept {
-    const auto iter = Cache.find(line);
-    if ( iter != Cache.end() ) {
-        return iter->second;
-    } //if ( iter != Cache.end() )
+std::int64_t part1(const std::vector<Line>& lines) {
+    return std::ranges::fold_left(lines | std::views::transform(calcNumberOfArrengements), 0, std::plus<>{});
+}
 
-    auto result = calcRecurse(line);
-    Cache.emplace(std::move(line), result);
-    return result;
+std::int64_t part2(const std::vector<Line>& lines) {
+    ArrangementCounter counter;
+    const auto         recurse = [&counter](Line line) { return counter.recurse(std::move(line)); };
+    return std::ranges::fold_left(lines | std::views::transform(unfold) | std::views::transform(recurse), 0,
+                                  std::plus<>{});
 }
 } //namespace
 
-bool challenge12(const std::vector<std::string_view>& input) {
-    const auto lines = parse(input);
-
-    std::int64_t sum1 =
-        std::ranges::fold_left(lines | std::views::transform(calcNumberOfArrengements), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-    std::int64_t sum11 = std::ranges::fold_left(lines | std::views::transform(recurse), 0, std::plus<>{});
-    myPrint(" == Result of Part 1(.1): {:d} ==\n", sum11);
-
-    std::int64_t sum2 = std::ranges::fold_left(lines | std::views::transform(unfold) | std::views::transform(recurse),
-                                               0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-
-    return sum1 == 7236 && sum2 == 11'607'695'322'318;
+const Challenge& challenge12(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(12, 7236, 11'607'695'322'318);
+    return challenge;
 }
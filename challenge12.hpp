@@ -1,9 +1,8 @@
 #ifndef CHALLENGE12_HPP
 #define CHALLENGE12_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge12(const std::vector<std::string_view>& input);
+const Challenge& challenge12(void) noexcept;
 
 #endif //CHALLENGE12_HPP
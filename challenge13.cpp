@@ -1,7 +1,6 @@
 #include "challenge13.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <ranges>
@@ -109,11 +108,11 @@ std::int64_t findMirrorInList(std::vector<std::string>& list) noexcept {
     } //for ( ;; )
 }
 
-void transpose(Pattern& pattern) noexcept {
+void transpose(Pattern& pattern) {
     auto rowCount    = pattern.Rows.size();
     auto columnCount = pattern.Rows.front().size();
     pattern.Columns.resize(columnCount);
-    std::ranges::for_each(pattern.Columns, [rowCount](auto& column) noexcept {
+    std::ranges::for_each(pattern.Columns, [rowCount](auto& column) {
         column.resize(rowCount);
         return;
     });
@@ -127,7 +126,7 @@ void transpose(Pattern& pattern) noexcept {
 }
 
 template<bool RepairSmudge>
-void findMirror(Pattern& pattern) noexcept {
+void findMirror(Pattern& pattern) {
     pattern.RowMirrored = findMirrorInList<RepairSmudge>(pattern.Rows);
     if ( pattern.RowMirrored != 0 ) {
         pattern.ColumnMirrored = 0;
@@ -142,18 +141,19 @@ void findMirror(Pattern& pattern) noexcept {
 std::int64_t mirrorPoints(const Pattern& pattern) noexcept {
     return pattern.ColumnMirrored + 100 * pattern.RowMirrored;
 }
-} //namespace
-
-bool challenge13(const std::vector<std::string_view>& input) {
-    auto patterns = parse(input);
 
+std::int64_t part1(std::vector<Pattern> patterns) {
     std::ranges::for_each(patterns, findMirror<false>);
-    std::int64_t sum1 = std::ranges::fold_left(patterns | std::views::transform(mirrorPoints), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    return std::ranges::fold_left(patterns | std::views::transform(mirrorPoints), 0, std::plus<>{});
+}
 
+std::int64_t part2(std::vector<Pattern> patterns) {
     std::ranges::for_each(patterns, findMirror<true>);
-    std::int64_t sum2 = std::ranges::fold_left(patterns | std::views::transform(mirrorPoints), 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+    return std::ranges::fold_left(patterns | std::views::transform(mirrorPoints), 0, std::plus<>{});
+}
+} //namespace
 
-    return sum1 == 37025 && sum2 == 32854;
+const Challenge& challenge13(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(13, 37025, 32854);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE13_HPP
 #define CHALLENGE13_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge13(const std::vector<std::string_view>& input);
+const Challenge& challenge13(void) noexcept;
 
 #endif //CHALLENGE13_HPP
@@ -1,280 +1,385 @@
 #include "challenge14.hpp"
 
-#include "print.hpp"
+#include "helper.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
-#include <iterator>
-#include <map>
-#include <ranges>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace {
-using MapData = std::vector<std::string>;
+using Word = std::uint64_t;
 
-struct RowIter {
-    public:
-    using difference_type   = std::int64_t;
-    using value_type        = char;
-    using reference         = char&;
-    using iterator_category = std::random_access_iterator_tag;
-
-    RowIter(void) noexcept : RowIter{nullptr, 0, 0, 0} {
-        return;
-    }
-
-    RowIter(MapData* data, std::size_t currentRow, std::size_t rowCount, std::size_t column) noexcept :
-            Data{data}, CurrentRow{currentRow}, RowCount{rowCount}, Column{column} {
-        return;
-    }
-
-    RowIter& operator++(void) noexcept {
-        ++CurrentRow;
-        return *this;
-    }
+constexpr std::size_t wordBits = 64;
 
-    RowIter operator++(int) noexcept {
-        auto ret = *this;
-        operator++();
-        return ret;
-    }
-
-    RowIter& operator--(void) noexcept {
-        --CurrentRow;
-        return *this;
-    }
-
-    RowIter operator--(int) noexcept {
-        auto ret = *this;
-        operator--();
-        return ret;
-    }
+constexpr std::size_t wordsFor(std::size_t bits) noexcept {
+    return (bits + wordBits - 1) / wordBits;
+}
 
-    RowIter& operator+=(std::int64_t i) noexcept {
-        CurrentRow = static_cast<std::size_t>(static_cast<std::int64_t>(CurrentRow) + i);
-        return *this;
-    }
+struct Fingerprint {
+    std::uint64_t Low;
+    std::uint64_t High;
 
-    RowIter operator+(std::int64_t i) const noexcept {
-        return RowIter{*this} += i;
-    }
+    constexpr bool operator==(const Fingerprint&) const noexcept = default;
+};
 
-    RowIter& operator-=(std::int64_t i) noexcept {
-        CurrentRow = static_cast<std::size_t>(static_cast<std::int64_t>(CurrentRow) - i);
-        return *this;
-    }
+constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+    //Der Finalizer von SplitMix64.
+    x ^= x >> 30;
+    x *= 0xBF58'476D'1CE4'E5B9;
+    x ^= x >> 27;
+    x *= 0x94D0'49BB'1331'11EB;
+    x ^= x >> 31;
+    return x;
+}
 
-    RowIter operator-(std::int64_t i) noexcept {
-        return RowIter{*this} -= i;
-    }
+/**
+ * @brief 128 Bit über die Wörter, aus zwei unabhängig gemischten Hälften. Bei den paar tausend Zuständen einer
+ * Eingabe ist eine Kollision praktisch ausgeschlossen, deshalb wird nicht mehr verglichen.
+ */
+constexpr Fingerprint fingerprint(std::span<const Word> words) noexcept {
+    Fingerprint ret{.Low = 0x243F'6A88'85A3'08D3, .High = 0x1319'8A2E'0370'7344};
+    for ( auto word : words ) {
+        ret.Low  = mix(ret.Low ^ word);
+        ret.High = std::rotl(ret.High, 23) + mix(word + 0x9E37'79B9'7F4A'7C15);
+    } //for ( auto word : words )
+    ret.High = mix(ret.High ^ words.size());
+    return ret;
+}
 
-    char& operator*(void) const noexcept {
-        return (*Data)[CurrentRow][Column];
+/**
+ * @brief Eine flache Hashtabelle mit offener Adressierung, vom Fingerabdruck zum ersten Zyklus mit diesem Zustand.
+ */
+class FingerprintTable {
+    public:
+    /**
+     * @return Der Zyklus, in dem fingerprint zuerst auftrat, sonst wird er mit cycle eingetragen und es gibt nullopt.
+     */
+    std::optional<int> findOrInsert(const Fingerprint& fingerprint, int cycle) {
+        if ( (Used + 1) * 2 > Slots.size() ) {
+            grow();
+        } //if ( (Used + 1) * 2 > Slots.size() )
+
+        auto& slot = probe(fingerprint);
+        if ( slot.Cycle >= 0 ) {
+            return slot.Cycle;
+        } //if ( slot.Cycle >= 0 )
+        slot = {fingerprint, cycle};
+        ++Used;
+        return std::nullopt;
     }
 
-    auto operator<=>(const RowIter&) const noexcept = default;
-
     private:
-    MapData*    Data;
-    std::size_t CurrentRow;
-    std::size_t RowCount;
-    std::size_t Column;
-};
-
-struct RowRange {
-    RowRange(MapData* data, std::size_t rowCount, std::size_t column) noexcept :
-            Data{data}, RowCount{rowCount}, Column{column} {
-        return;
+    struct Slot {
+        Fingerprint Key{0, 0};
+        //! -1 für einen freien Platz.
+        int         Cycle = -1;
+    };
+
+    std::vector<Slot> Slots = std::vector<Slot>(64);
+    std::size_t       Used  = 0;
+
+    /**
+     * @return Der Platz mit fingerprint oder der freie, an den er gehört. Die Größe ist immer eine Zweierpotenz.
+     */
+    Slot& probe(const Fingerprint& fingerprint) noexcept {
+        for ( auto index = fingerprint.Low & (Slots.size() - 1);; index = (index + 1) & (Slots.size() - 1) ) {
+            if ( Slots[index].Cycle < 0 || Slots[index].Key == fingerprint ) {
+                return Slots[index];
+            } //if ( Slots[index].Cycle < 0 || Slots[index].Key == fingerprint )
+        } //for ( auto index = fingerprint.Low & (Slots.size() - 1);; index = (index + 1) & (Slots.size() - 1) )
     }
 
-    auto begin(void) const noexcept {
-        return RowIter{Data, 0, RowCount, Column};
-    }
-
-    auto end(void) const noexcept {
-        return RowIter{Data, RowCount, RowCount, Column};
-    }
-
-    bool operator==(const RowRange&) const noexcept {
-        return true;
+    void grow(void) {
+        auto old = std::exchange(Slots, std::vector<Slot>(Slots.size() * 2));
+        for ( const auto& slot : old ) {
+            if ( slot.Cycle >= 0 ) {
+                probe(slot.Key) = slot;
+            } //if ( slot.Cycle >= 0 )
+        } //for ( const auto& slot : old )
+        return;
     }
-
-    private:
-    MapData*    Data;
-    std::size_t RowCount;
-    std::size_t Column;
 };
 
-struct ColumnSentinel {};
+/**
+ * @brief Transponiert eine 64x64 Bitmatrix, Bit c von block[r] tauscht mit Bit r von block[c].
+ *
+ * In sechs Runden werden immer kleinere Quadranten über die Diagonale getauscht (Hacker's Delight).
+ */
+constexpr void transposeBlock(std::array<Word, wordBits>& block) noexcept {
+    Word mask = 0x0000'0000'FFFF'FFFF;
+    for ( std::size_t width = wordBits / 2; width != 0; width >>= 1, mask ^= mask << width ) {
+        for ( std::size_t low = 0; low < wordBits; low = ((low | width) + 1) & ~width ) {
+            const auto high   = low | width;
+            const auto swap   = ((block[low] >> width) ^ block[high]) & mask;
+            block[low]       ^= swap << width;
+            block[high]      ^= swap;
+        } //for ( std::size_t low = 0; low < wordBits; low = ((low | width) + 1) & ~width )
+    } //for ( std::size_t width = wordBits / 2; width != 0; width >>= 1, mask ^= mask << width )
+    return;
+}
 
-struct ColumnIter {
+/**
+ * @brief Die Plattform als Bitboards, ein Bit pro Feld.
+ *
+ * Die Steine liegen einmal zeilenweise und einmal spaltenweise vor, jede Zeile und Spalte beginnt mit einem neuen
+ * Wort. Nach Norden und Süden wird über die Zeilen geneigt, dabei rollen die 64 Spalten eines Wortes gleichzeitig,
+ * nach Westen und Osten genauso über die Spalten. Die festen Steine ändern sich nie, die rollenden werden erst
+ * umgerechnet, wenn die andere Anordnung gebraucht wird.
+ *
+ * Alle vier Ebenen liegen in einem Puffer. Die Zeilen und Spalten sind auf ein Vielfaches von 64 aufgefüllt, so
+ * zerfällt jede Ebene in Kacheln von 64x64 Bits, die einzeln in einem Stück transponiert werden. Beim Neigen wird
+ * jede Zeile (bzw. Spalte) Wort für Wort am Stück gelesen.
+ */
+class Platform {
     public:
-    using difference_type = std::int64_t;
-    using value_type      = RowRange;
-
-    ColumnIter(MapData* data, std::size_t rowCount, std::size_t column, std::size_t columnCount) noexcept :
-            Data{data}, RowCount{rowCount}, Column{column}, ColumnCount{columnCount}, Rows{data, rowCount, column} {
+    explicit Platform(const std::vector<std::string_view>& input) :
+            RowCount{input.size()}, ColumnCount{input.empty() ? 0 : input.front().size()},
+            RowWords{wordsFor(ColumnCount)}, ColumnWords{wordsFor(RowCount)},
+            PlaneSize{RowWords * ColumnWords * wordBits}, Words(PlaneSize * 4) {
+        throwIfInvalid(RowCount > 0 && ColumnCount > 0);
+        const auto rowRocks = plane(Plane::RowRocks);
+        const auto rowCubes = plane(Plane::RowCubes);
+        for ( std::size_t row = 0; row < RowCount; ++row ) {
+            throwIfInvalid(input[row].size() == ColumnCount);
+            for ( std::size_t column = 0; column < ColumnCount; ++column ) {
+                const auto index = row * RowWords + column / wordBits;
+                const auto bit   = Word{1} << (column % wordBits);
+                switch ( input[row][column] ) {
+                    case 'O' : rowRocks[index] |= bit; break;
+                    case '#' : rowCubes[index] |= bit; break;
+                    case '.' : break;
+                    default  : throwIfInvalid(false); break;
+                } //switch ( input[row][column] )
+            } //for ( std::size_t column = 0; column < ColumnCount; ++column )
+        } //for ( std::size_t row = 0; row < RowCount; ++row )
+
+        transpose(rowCubes, RowWords, plane(Plane::ColumnCubes), ColumnWords);
+        transpose(rowRocks, RowWords, plane(Plane::ColumnRocks), ColumnWords);
         return;
     }
 
-    ColumnIter& operator++(void) noexcept {
-        ++Column;
-        Rows = RowRange{Data, RowCount, Column};
-        return *this;
+    void tiltNorth(void) {
+        tiltRows(true);
+        return;
     }
 
-    ColumnIter operator++(int) noexcept {
-        auto ret = *this;
-        operator++();
-        return ret;
+    void tiltSouth(void) {
+        tiltRows(false);
+        return;
     }
 
-    const RowRange& operator*(void) const noexcept {
-        return Rows;
+    void tiltWest(void) {
+        tiltColumns(true);
+        return;
     }
 
-    bool operator==(const ColumnIter&) const noexcept = default;
-
-    friend bool operator==(const ColumnIter& iter, ColumnSentinel) noexcept {
-        return iter.Column == iter.ColumnCount;
+    void tiltEast(void) {
+        tiltColumns(false);
+        return;
     }
 
-    private:
-    MapData*    Data;
-    std::size_t RowCount;
-    std::size_t Column;
-    std::size_t ColumnCount;
-    RowRange    Rows;
-};
-
-struct ColumnRange {
-    public:
-    ColumnRange(MapData* data, std::size_t rowCount, std::size_t columnCount) noexcept :
-            Data{data}, RowCount{rowCount}, ColumnCount{columnCount} {
+    void spin(void) {
+        tiltNorth();
+        tiltWest();
+        tiltSouth();
+        tiltEast();
         return;
     }
 
-    auto begin(void) noexcept {
-        return ColumnIter{Data, RowCount, 0, ColumnCount};
+    std::int64_t northLoad(void) noexcept {
+        const auto  rowRocks = rocks();
+        std::size_t ret      = 0;
+        for ( std::size_t row = 0; row < RowCount; ++row ) {
+            std::size_t rocks = 0;
+            for ( auto word : rowRocks.subspan(row * RowWords, RowWords) ) {
+                rocks += static_cast<std::size_t>(std::popcount(word));
+            } //for ( auto word : rowRocks.subspan(row * RowWords, RowWords) )
+            ret += (RowCount - row) * rocks;
+        } //for ( std::size_t row = 0; row < RowCount; ++row )
+        return static_cast<std::int64_t>(ret);
     }
 
-    auto end(void) noexcept {
-        return ColumnSentinel{};
+    /**
+     * @return Die rollenden Steine zeilenweise, als Zustand für die Erkennung der Zyklen.
+     */
+    std::span<const Word> rocks(void) noexcept {
+        syncRows();
+        return plane(Plane::RowRocks).first(RowCount * RowWords);
     }
 
     private:
-    MapData*    Data;
-    std::size_t RowCount;
-    std::size_t ColumnCount;
-};
-
-struct Map {
-    MapData     Data;
-    std::size_t RowCount;
-    std::size_t ColumnCount;
-
-    auto northFirstRange(void) noexcept {
-        return ColumnRange{&Data, RowCount, ColumnCount};
+    enum class Plane : std::size_t { RowRocks, RowCubes, ColumnRocks, ColumnCubes };
+
+    std::size_t       RowCount;
+    std::size_t       ColumnCount;
+    std::size_t       RowWords;
+    std::size_t       ColumnWords;
+    //! Jede Ebene hat ColumnWords * 64 Zeilen mit RowWords Wörtern, oder RowWords * 64 Spalten mit ColumnWords.
+    std::size_t       PlaneSize;
+    std::vector<Word> Words;
+    bool              RowsCurrent    = true;
+    bool              ColumnsCurrent = true;
+    //! Die Zähler aus dem ersten Durchlauf von tiltAcross, pro Zeile am Stück.
+    std::vector<Word> Counts;
+    //! Die Zähler eines Durchlaufs, pro Wort der Zeile planes Wörter.
+    std::vector<Word> Counters;
+
+    std::span<Word> plane(Plane which) noexcept {
+        return std::span{Words}.subspan(static_cast<std::size_t>(which) * PlaneSize, PlaneSize);
     }
 
-    auto southFirstRange(void) noexcept {
-        return northFirstRange() |
-               std::views::transform([](auto&& range) noexcept { return range | std::views::reverse; });
+    /**
+     * @brief Rechnet eine Ebene in die andere Anordnung um, Kachel für Kachel.
+     * @param[in] fromWords Die Wörter pro Zeile in from, toWords die in to.
+     */
+    static void transpose(std::span<const Word> from, std::size_t fromWords, std::span<Word> to,
+                          std::size_t toWords) noexcept {
+        std::array<Word, wordBits> block;
+        for ( std::size_t lineBlock = 0; lineBlock < toWords; ++lineBlock ) {
+            for ( std::size_t word = 0; word < fromWords; ++word ) {
+                for ( std::size_t i = 0; i < wordBits; ++i ) {
+                    block[i] = from[(lineBlock * wordBits + i) * fromWords + word];
+                } //for ( std::size_t i = 0; i < wordBits; ++i )
+                transposeBlock(block);
+                for ( std::size_t i = 0; i < wordBits; ++i ) {
+                    to[(word * wordBits + i) * toWords + lineBlock] = block[i];
+                } //for ( std::size_t i = 0; i < wordBits; ++i )
+            } //for ( std::size_t word = 0; word < fromWords; ++word )
+        } //for ( std::size_t lineBlock = 0; lineBlock < toWords; ++lineBlock )
+        return;
     }
 
-    auto westFirstRange(void) noexcept {
-        return Data | std::views::take(RowCount);
+    /**
+     * @brief Neigt über alle lines hinweg, für jedes Bit eines Wortes gleichzeitig.
+     *
+     * Jedes Bit hat einen Zähler, der auf mehrere Wörter verteilt ist (bit-sliced), Bit b des Zählers liegt im Wort b.
+     * Der erste Durchlauf geht von hinten und zählt die rollenden Steine bis zum nächsten festen. Der zweite übernimmt
+     * am Anfang jedes Abschnitts diese Zahl und setzt Steine, bis sie aufgebraucht ist. Das kostet pro Wort und Zeile
+     * einige Operationen pro Zählerbit, egal wie die Steine liegen.
+     * @param[in] towardsFirst Ob die Steine zur ersten Zeile (Norden, Westen) rollen oder zur letzten.
+     */
+    void tiltAcross(std::span<Word> rocks, std::span<const Word> cubes, std::size_t lines, std::size_t lineWords,
+                    bool towardsFirst) {
+        const auto planes    = std::bit_width(lines);
+        const auto stepWords = lineWords * planes;
+        Counts.resize(lines * stepWords);
+        Counters.assign(stepWords, 0);
+
+        auto offsetOf = [=](std::size_t step) noexcept {
+            return (towardsFirst ? step : lines - 1 - step) * lineWords;
+        };
+
+        for ( auto step = lines; step-- > 0; ) {
+            const auto offset = offsetOf(step);
+            for ( std::size_t word = 0; word < lineWords; ++word ) {
+                const auto cube    = cubes[offset + word];
+                const auto counter = std::span{Counters}.subspan(word * planes, planes);
+                auto       carry   = rocks[offset + word];
+                for ( std::size_t plane = 0; plane < planes; ++plane ) {
+                    counter[plane]  &= ~cube;
+                    const auto next  = counter[plane] & carry;
+                    counter[plane]  ^= carry;
+                    carry            = next;
+                } //for ( std::size_t plane = 0; plane < planes; ++plane )
+            } //for ( std::size_t word = 0; word < lineWords; ++word )
+            std::ranges::copy(Counters, std::span{Counts}.subspan(step * stepWords).begin());
+        } //for ( auto step = lines; step-- > 0; )
+
+        //Ab hier zählen die Counters herunter, was noch zu setzen ist.
+        std::ranges::fill(Counters, 0);
+        for ( std::size_t step = 0; step < lines; ++step ) {
+            const auto offset = offsetOf(step);
+            for ( std::size_t word = 0; word < lineWords; ++word ) {
+                //Der Rand wirkt wie ein fester Stein.
+                const auto previousCube = step == 0 ? ~Word{0} : cubes[offsetOf(step - 1) + word];
+                const auto cube         = cubes[offset + word];
+                const auto segmentStart = previousCube & ~cube;
+                const auto counts       = std::span{Counts}.subspan(step * stepWords + word * planes, planes);
+                const auto remaining    = std::span{Counters}.subspan(word * planes, planes);
+                Word       any          = 0;
+                for ( std::size_t plane = 0; plane < planes; ++plane ) {
+                    remaining[plane]  = (remaining[plane] & ~segmentStart) | (counts[plane] & segmentStart);
+                    any              |= remaining[plane];
+                } //for ( std::size_t plane = 0; plane < planes; ++plane )
+
+                const auto rock   = any & ~cube;
+                auto       borrow = rock;
+                for ( std::size_t plane = 0; plane < planes; ++plane ) {
+                    const auto next   = ~remaining[plane] & borrow;
+                    remaining[plane] ^= borrow;
+                    borrow            = next;
+                } //for ( std::size_t plane = 0; plane < planes; ++plane )
+                rocks[offset + word] = rock;
+            } //for ( std::size_t word = 0; word < lineWords; ++word )
+        } //for ( std::size_t step = 0; step < lines; ++step )
+        return;
     }
 
-    auto eastFirstRange(void) noexcept {
-        return westFirstRange() |
-               std::views::transform([](auto&& range) noexcept { return range | std::views::reverse; });
+    void syncRows(void) noexcept {
+        if ( !RowsCurrent ) {
+            transpose(plane(Plane::ColumnRocks), ColumnWords, plane(Plane::RowRocks), RowWords);
+            RowsCurrent = true;
+        } //if ( !RowsCurrent )
+        return;
     }
-};
 
-auto parse(const std::vector<std::string_view>& input) {
-    Map map;
-    for ( auto inputLine : input ) {
-        map.Data.emplace_back(inputLine);
-    } //for ( auto inputLine : input )
-    map.RowCount    = map.Data.size();
-    map.ColumnCount = map.Data.front().size();
-    return map;
-}
+    void syncColumns(void) noexcept {
+        if ( !ColumnsCurrent ) {
+            transpose(plane(Plane::RowRocks), RowWords, plane(Plane::ColumnRocks), ColumnWords);
+            ColumnsCurrent = true;
+        } //if ( !ColumnsCurrent )
+        return;
+    }
 
-struct Tilt {
-    template<typename R>
-    R&& operator()(R&& range) noexcept {
-        static std::array lookFor = {'O', '#'};
-        for ( auto target = std::ranges::find(range, '.'), end = range.end(); target != end;
-              target = std::ranges::find(std::next(target), end, '.') ) {
-            if ( auto toMove = std::ranges::find_first_of(std::next(target), end, lookFor.begin(), lookFor.end());
-                 toMove != end ) {
-                if ( *toMove == 'O' ) {
-                    std::swap(*target, *toMove);
-                } //if ( *toMove == 'O' )
-                else {
-                    target = toMove;
-                } //else -> if ( *toMove == 'O' )
-            } //if ( auto toMove = std::ranges::find(std::next(target), end, lookFor); toMove != end )
-        }
-        return range;
+    void tiltRows(bool towardsFirst) {
+        syncRows();
+        tiltAcross(plane(Plane::RowRocks), plane(Plane::RowCubes), RowCount, RowWords, towardsFirst);
+        ColumnsCurrent = false;
+        return;
     }
-};
 
-struct CalcLoad {
-    template<typename R>
-    std::int64_t operator()(R row) noexcept {
-        return std::ranges::fold_left(
-            std::views::zip_transform([](char field, std::int64_t index) noexcept { return field == 'O' ? index : 0; },
-                                      row, std::views::iota(std::int64_t{1})),
-            0, std::plus<>{});
+    void tiltColumns(bool towardsFirst) {
+        syncColumns();
+        tiltAcross(plane(Plane::ColumnRocks), plane(Plane::ColumnCubes), ColumnCount, ColumnWords, towardsFirst);
+        RowsCurrent = false;
+        return;
     }
 };
-} //namespace
-
-#include <chrono>
-
-bool challenge14(const std::vector<std::string_view>& input) {
-    const auto map    = parse(input);
-    auto       runMap = map;
-
-    std::ranges::for_each(runMap.northFirstRange(), Tilt{});
-    std::int64_t sum1 =
-        std::ranges::fold_left(runMap.southFirstRange() | std::views::transform(CalcLoad{}), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
 
-    std::map<MapData, std::pair<MapData, int>> cache;
-    MapData                                    prev;
-    MapData                                    cacheCycleStartData;
-
-    runMap                                                     = map;
-    const auto numberOfCycles                                  = 1'000'000'000;
-
-    using Clock                                                = std::chrono::system_clock;
-    const auto start                                           = Clock::now();
-    for ( auto cycle = 1; cycle <= numberOfCycles; ++cycle ) {
-        auto iter = cache.lower_bound(runMap.Data);
-        if ( iter != cache.end() && iter->first == runMap.Data ) {
-            const auto cycleLength     = cycle - iter->second.second;
-            const auto remainingCycles = (numberOfCycles - cycle) % cycleLength;
-            runMap.Data = iter->second.first;
-            cycle       = numberOfCycles - remainingCycles;
-            continue;
-        } //if ( iter != cache.end() && iter->first == runMap.Data )
-
-        prev = runMap.Data;
-
-        std::ranges::for_each(runMap.northFirstRange(), Tilt{});
-        std::ranges::for_each(runMap.westFirstRange(), Tilt{});
-        std::ranges::for_each(runMap.southFirstRange(), Tilt{});
-        std::ranges::for_each(runMap.eastFirstRange(), Tilt{});
+Platform parse(const std::vector<std::string_view>& input) {
+    return Platform{input};
+}
 
-        cache.insert(iter, {prev, std::pair{runMap.Data, cycle}});
-    } //for ( auto cycle = 1; cycle <= numberOfCycles; ++cycle )
+std::int64_t part1(Platform platform) {
+    platform.tiltNorth();
+    return platform.northLoad();
+}
 
-    std::int64_t sum2 =
-        std::ranges::fold_left(runMap.southFirstRange() | std::views::transform(CalcLoad{}), 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+std::int64_t part2(Platform platform) {
+    FingerprintTable          seen;
+    //! Die Last nach so vielen Zyklen wie der Index, statt ganzer Kopien der Steine.
+    std::vector<std::int64_t> loads;
+
+    const auto numberOfCycles = 1'000'000'000;
+    for ( auto cycle = 0; cycle < numberOfCycles; ++cycle ) {
+        loads.push_back(platform.northLoad());
+        if ( const auto first = seen.findOrInsert(fingerprint(platform.rocks()), cycle) ) {
+            const auto cycleLength = cycle - *first;
+            return loads[static_cast<std::size_t>(*first + (numberOfCycles - *first) % cycleLength)];
+        } //if ( const auto first = seen.findOrInsert(fingerprint(platform.rocks()), cycle) )
+        platform.spin();
+    } //for ( auto cycle = 0; cycle < numberOfCycles; ++cycle )
+
+    return platform.northLoad();
+}
+} //namespace
 
-    return sum1 == 108935 && sum2 == 100876;
+const Challenge& challenge14(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(14, 108935, 100876);
+    return challenge;
 }
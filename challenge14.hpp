@@ -1,9 +1,8 @@
 #ifndef CHALLENGE14_HPP
 #define CHALLENGE14_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge14(const std::vector<std::string_view>& input);
+const Challenge& challenge14(void) noexcept;
 
 #endif //CHALLENGE14_HPP
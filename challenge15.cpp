@@ -1,10 +1,10 @@
 #include "challenge15.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <array>
+#include <iterator>
 #include <ranges>
 
 using namespace std::string_view_literals;
@@ -33,17 +33,22 @@ std::int64_t calcBoxPower(std::tuple<const Box&, int> boxAndNumber) noexcept {
                                       std::views::transform(calcLensPower),
                                   0, std::plus<>{});
 }
-} //namespace
 
-bool challenge15(const std::vector<std::string_view>& input) {
+std::vector<std::string_view> parse(const std::vector<std::string_view>& input) {
     throwIfInvalid(input.size() == 1);
-    std::int64_t sum1 =
-        std::ranges::fold_left(splitString(input.front(), ',') | std::views::transform(hash), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    std::vector<std::string_view> ret;
+    std::ranges::copy(splitString(input.front(), ','), std::back_inserter(ret));
+    return ret;
+}
 
+std::int64_t part1(const std::vector<std::string_view>& steps) noexcept {
+    return std::ranges::fold_left(steps | std::views::transform(hash), 0, std::plus<>{});
+}
+
+std::int64_t part2(const std::vector<std::string_view>& steps) {
     std::array<Box, 256> boxes;
 
-    for ( std::string_view line : splitString(input.front(), ',') ) {
+    for ( std::string_view line : steps ) {
         const auto actionPos = line.find_first_of("=-"sv);
         throwIfInvalid(actionPos != std::string_view::npos);
         const auto label  = line.substr(0, actionPos);
@@ -66,11 +71,14 @@ bool challenge15(const std::vector<std::string_view>& input) {
                 iter->second = value;
             } //else -> if ( iter == box.end() )
         } //else -> if ( action == '-' )
-    } //for ( std::string_view line : splitString(input.front(), ',') )
+    } //for ( std::string_view line : steps )
 
-    std::int64_t sum2 = std::ranges::fold_left(
-        std::views::zip(boxes, std::views::iota(1)) | std::views::transform(calcBoxPower), 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+    return std::ranges::fold_left(std::views::zip(boxes, std::views::iota(1)) | std::views::transform(calcBoxPower), 0,
+                                  std::plus<>{});
+}
+} //namespace
 
-    return sum1 == 506437 && sum2 == 288521;
+const Challenge& challenge15(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(15, 506437, 288521);
+    return challenge;
 }
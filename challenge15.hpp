@@ -1,9 +1,8 @@
 #ifndef CHALLENGE15_HPP
 #define CHALLENGE15_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge15(const std::vector<std::string_view>& input);
+const Challenge& challenge15(void) noexcept;
 
 #endif //CHALLENGE15_HPP
@@ -1,11 +1,22 @@
 #include "challenge16.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
+#include "threadpool.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <ranges>
-#include <unordered_set>
+#include <span>
+#include <utility>
+#include <vector>
 
 using namespace std::string_view_literals;
 
@@ -35,164 +46,645 @@ struct Coordinate {
     }
 };
 
-using CoordinateAndDirection = std::pair<Coordinate, Direction>;
-} //namespace
+constexpr std::uint8_t directionBit(Direction dir) noexcept {
+    return static_cast<std::uint8_t>(1 << static_cast<int>(dir));
+}
 
-namespace std {
-template<>
-struct hash<Coordinate> {
-    size_t operator()(const Coordinate& c) const noexcept {
-        std::hash<std::size_t> h;
-        return h(c.Row << 8) ^ h(c.Column);
-    }
-};
+Coordinate move(Coordinate pos, Direction dir) noexcept {
+    switch ( dir ) {
+        case Direction::Left  : return pos.left();
+        case Direction::Right : return pos.right();
+        case Direction::Up    : return pos.up();
+        case Direction::Down  : return pos.down();
+    } //switch ( dir )
+    return pos;
+}
 
-template<>
-struct hash<CoordinateAndDirection> {
-    size_t operator()(const CoordinateAndDirection& cd) const noexcept {
-        std::hash<Coordinate> c;
-        std::hash<Direction>  d;
-        return (c(cd.first) << 8) ^ d(cd.second);
-    }
-};
-} //namespace std
+constexpr bool isSplitter(char field) noexcept {
+    return field == '|' || field == '-';
+}
 
-namespace {
+std::int64_t countBits(const std::vector<std::uint64_t>& bits) noexcept {
+    return std::ranges::fold_left(bits | std::views::transform([](std::uint64_t word) noexcept {
+                                      return static_cast<std::int64_t>(std::popcount(word));
+                                  }),
+                                  std::int64_t{0}, std::plus<>{});
+}
+
+/**
+ * @brief Wie der Strahl auf dem Feld weitergeht.
+ * @return Die neue Richtung und bei einem Splitter die zweite.
+ */
+std::pair<Direction, std::optional<Direction>> deflect(char field, Direction dir) noexcept {
+    //In der Reihenfolge Up, Down, Left, Right.
+    constexpr std::array slash{Direction::Right, Direction::Left, Direction::Down, Direction::Up};
+    constexpr std::array backslash{Direction::Left, Direction::Right, Direction::Up, Direction::Down};
+
+    const bool horizontal = dir == Direction::Left || dir == Direction::Right;
+    switch ( field ) {
+        case '.'  : return {dir, std::nullopt};
+        case '/'  : return {slash[static_cast<std::size_t>(dir)], std::nullopt};
+        case '\\' : return {backslash[static_cast<std::size_t>(dir)], std::nullopt};
+
+        case '|'  : {
+            if ( horizontal ) {
+                return {Direction::Up, Direction::Down};
+            } //if ( horizontal )
+            return {dir, std::nullopt};
+        } //case '|'
+
+        case '-'  : {
+            if ( !horizontal ) {
+                return {Direction::Left, Direction::Right};
+            } //if ( !horizontal )
+            return {dir, std::nullopt};
+        } //case '-'
+    } //switch ( field )
+    checkInvariant(false);
+    return {dir, std::nullopt};
+}
+
+/**
+ * @brief Verfolgt die Strahlen iterativ, mit einem Stack für die zweiten Strahlen der Splitter.
+ *
+ * Pro Feld merkt sich ein Byte, in welche Richtungen es schon durchlaufen wurde. Bei 110x110 sind das 12 KiB, und
+ * auch große Karten laufen nicht mehr in eine Rekursionstiefe proportional zur Größe. Die beleuchteten Felder stehen
+ * zusätzlich in einem Bitset, gezählt wird erst am Ende mit popcount.
+ */
 struct Energizer {
+    struct Beam {
+        Coordinate Position;
+        Direction  Dir;
+    };
+
     const std::vector<std::string_view>& Map;
     const std::size_t                    RowCount;
     const std::size_t                    ColumnCount;
 
-    std::unordered_set<Coordinate>                           AlreadyEnergized;
-    std::unordered_set<CoordinateAndDirection>               AlreadyVisited;
+    std::vector<std::uint8_t>  Visited;
+    std::vector<std::uint64_t> Energized;
+    std::vector<Beam>          Pending;
 
-    Energizer(const std::vector<std::string_view>& map) noexcept :
-            Map{map}, RowCount{map.size()}, ColumnCount{map.front().size()} {
+    Energizer(const std::vector<std::string_view>& map) :
+            Map{map}, RowCount{map.size()}, ColumnCount{map.front().size()}, Visited(RowCount * ColumnCount),
+            Energized((RowCount * ColumnCount + 63) / 64) {
         return;
     }
 
-    std::int64_t startEnergize(Coordinate pos = {0, 0}, Direction dir = Direction::Right) noexcept {
-        AlreadyVisited.clear();
-        AlreadyEnergized.clear();
-        return energize(pos, dir);
+    std::int64_t startEnergize(Coordinate pos = {0, 0}, Direction dir = Direction::Right) {
+        std::ranges::fill(Visited, 0);
+        std::ranges::fill(Energized, 0);
+        Pending.clear();
+        Pending.push_back({pos, dir});
+
+        while ( !Pending.empty() ) {
+            auto [position, direction] = Pending.back();
+            Pending.pop_back();
+
+            //Durch die Größe ohne Vorzeichen sind auch die Positionen links und über der Karte zu groß.
+            while ( position.Row < RowCount && position.Column < ColumnCount ) {
+                const auto cell    = position.Row * ColumnCount + position.Column;
+                auto&      visited = Visited[cell];
+                const auto bit     = directionBit(direction);
+                if ( visited & bit ) {
+                    break;
+                } //if ( visited & bit )
+
+                visited              |= bit;
+                Energized[cell / 64] |= std::uint64_t{1} << (cell % 64);
+
+                const auto [next, split] = deflect(Map[position.Row][position.Column], direction);
+                if ( split ) {
+                    Pending.push_back({move(position, *split), *split});
+                } //if ( split )
+                direction = next;
+                position  = move(position, direction);
+            } //while ( position.Row < RowCount && position.Column < ColumnCount )
+        } //while ( !Pending.empty() )
+        return countBits(Energized);
     }
+};
 
-    std::int64_t energize(Coordinate pos, Direction dir) noexcept {
-        if ( !AlreadyVisited.insert({pos, dir}).second ) {
-            return 0;
-        } //if ( !AlreadyVisited.insert({pos, dir}).second )
-
-        std::int64_t res = AlreadyEnergized.insert(pos).second ? 1 : 0;
-        switch ( dir ) {
-            case Direction::Left  : res += moveLeft(pos); break;
-            case Direction::Right : res += moveRight(pos); break;
-            case Direction::Up    : res += moveUp(pos); break;
-            case Direction::Down  : res += moveDown(pos); break;
-        } //switch ( dir )
-        // Cache.emplace(CoordinateAndDirection{pos, dir}, res);
-        return res;
+/**
+ * @brief Die Strahlen als Graph, damit nicht jeder Startpunkt alles neu verfolgen muss.
+ *
+ * Die Knoten sind die Splitter, die ihre beiden Abschnitte aussenden, wenn sie von der Breitseite getroffen werden.
+ * Jeder Abschnitt kennt die Felder, die er beleuchtet, und den Splitter, an dem er endet. Die starken
+ * Zusammenhangskomponenten (Tarjan) bilden einen azyklischen Graphen. Über den entsteht für jede Komponente, die ein
+ * Startpunkt erreicht, die Menge aller Felder, die von ihr aus beleuchtet werden (siehe Reach). Sie lebt nur, bis die
+ * letzte Komponente davor sie übernommen hat, ein Startpunkt prüft nur noch seinen ersten Abschnitt dagegen.
+ */
+class BeamGraph {
+    public:
+    explicit BeamGraph(const std::vector<std::string_view>& map) :
+            Map{map}, RowCount{map.size()}, ColumnCount{map.front().size()}, Words{(RowCount * ColumnCount + 63) / 64},
+            NodeOfCell(RowCount * ColumnCount, noNode) {
+        std::vector<Coordinate> positions;
+        for ( std::size_t row = 0; row < RowCount; ++row ) {
+            throwIfInvalid(Map[row].size() == ColumnCount);
+            for ( std::size_t column = 0; column < ColumnCount; ++column ) {
+                if ( isSplitter(Map[row][column]) ) {
+                    NodeOfCell[row * ColumnCount + column] = static_cast<std::uint32_t>(positions.size());
+                    positions.push_back({row, column});
+                } //if ( isSplitter(Map[row][column]) )
+            } //for ( std::size_t column = 0; column < ColumnCount; ++column )
+        } //for ( std::size_t row = 0; row < RowCount; ++row )
+
+        Nodes.resize(positions.size());
+        for ( auto&& [node, position] : std::views::zip(Nodes, positions) ) {
+            const auto outputs = Map[position.Row][position.Column] == '|'
+                                     ? std::array{Direction::Up, Direction::Down}
+                                     : std::array{Direction::Left, Direction::Right};
+            for ( std::size_t i = 0; i < outputs.size(); ++i ) {
+                node.Targets[i] = trace(move(position, outputs[i]), outputs[i], node.Cells);
+            } //for ( std::size_t i = 0; i < outputs.size(); ++i )
+        } //for ( auto&& [node, position] : std::views::zip(Nodes, positions) )
+
+        condense();
+        return;
     }
 
-    std::int64_t checkValidAndEnergize(Coordinate pos, Direction dir) noexcept {
-        if ( pos.Row >= RowCount || pos.Column >= ColumnCount ) {
-            return 0;
-        } //if ( pos.Row >= RowCount || pos.Column >= ColumnCount )
-        return energize(pos, dir);
+    /**
+     * @brief Die meisten beleuchteten Felder über alle Startpunkte.
+     * @param[in] maxLiveWords Wie viele Wörter die gleichzeitig benötigten Mengen höchstens belegen dürfen.
+     * @return Das Maximum oder nullopt, wenn die Mengen mehr Speicher bräuchten.
+     */
+    std::optional<std::int64_t> maxEnergized(const std::vector<Energizer::Beam>& starts,
+                                             std::size_t                         maxLiveWords) const {
+        const auto componentCount = ComponentOffsets.size() - 1;
+
+        //Die ersten Abschnitte hintereinander, startOffsets[i] bis startOffsets[i + 1] gehört zu starts[i].
+        std::vector<std::uint32_t>                           startCells;
+        std::vector<std::size_t>                             startOffsets{0};
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> startsOfComponents;
+        std::vector<bool>                                    needed(componentCount);
+        std::vector<std::uint32_t>                           pending;
+        for ( const auto& [position, direction] : starts ) {
+            if ( const auto target = trace(position, direction, startCells); target != noNode ) {
+                const auto component = ComponentOfNode[target];
+                startsOfComponents.emplace_back(component, static_cast<std::uint32_t>(startOffsets.size() - 1));
+                if ( !needed[component] ) {
+                    needed[component] = true;
+                    pending.push_back(component);
+                } //if ( !needed[component] )
+            } //if ( const auto target = trace(position, direction, startCells); target != noNode )
+            startOffsets.push_back(startCells.size());
+        } //for ( const auto& [position, direction] : starts )
+        std::ranges::sort(startsOfComponents);
+
+        //Wie viele benötigte Komponenten die Menge noch übernehmen, danach wird sie frei.
+        std::vector<std::uint32_t> references(componentCount);
+        while ( !pending.empty() ) {
+            const auto component = pending.back();
+            pending.pop_back();
+            for ( auto successor : successors(component) ) {
+                ++references[successor];
+                if ( !needed[successor] ) {
+                    needed[successor] = true;
+                    pending.push_back(successor);
+                } //if ( !needed[successor] )
+            } //for ( auto successor : successors(component) )
+        } //while ( !pending.empty() )
+
+        //Ein Abschnitt kann ein Feld mehrfach durchlaufen und eine Liste lässt sich nicht direkt abfragen, die
+        //Generation markiert die schon gezählten Felder.
+        std::vector<std::uint32_t> counted(RowCount * ColumnCount);
+        std::uint32_t              generation = 0;
+        const auto                 energize   = [&](std::uint32_t start, const Reach* reach) noexcept {
+            ++generation;
+            std::int64_t ret = 0;
+            if ( reach ) {
+                for ( auto cell : reach->Cells ) {
+                    counted[cell] = generation;
+                } //for ( auto cell : reach->Cells )
+                ret = reach->count();
+            } //if ( reach )
+
+            for ( auto i = startOffsets[start]; i < startOffsets[start + 1]; ++i ) {
+                const auto cell = startCells[i];
+                if ( counted[cell] == generation || (reach && reach->inBase(cell)) ) {
+                    continue;
+                } //if ( counted[cell] == generation || (reach && reach->inBase(cell)) )
+                counted[cell] = generation;
+                ++ret;
+            } //for ( auto i = startOffsets[start]; i < startOffsets[start + 1]; ++i )
+            return ret;
+        };
+
+        std::int64_t ret = 0;
+        for ( std::uint32_t start = 0; start < starts.size(); ++start ) {
+            ret = std::max(ret, energize(start, nullptr));
+        } //for ( std::uint32_t start = 0; start < starts.size(); ++start )
+
+        //Tarjan schließt eine Komponente erst ab, wenn alle von ihr erreichbaren abgeschlossen sind. In der Reihenfolge
+        //der Nummern stehen die Mengen der Nachfolger also schon.
+        const auto         budget = std::make_shared<ReachBudget>();
+        std::vector<Reach> reaches(componentCount);
+        auto               nextStart = startsOfComponents.begin();
+        for ( std::uint32_t component = 0; component < componentCount; ++component ) {
+            if ( !needed[component] ) {
+                continue;
+            } //if ( !needed[component] )
+
+            auto& reach = reaches[component];
+            reach              = collect(component, reaches, budget);
+            budget->LiveWords += reach.listWords();
+            if ( budget->LiveWords > maxLiveWords ) {
+                return std::nullopt;
+            } //if ( budget->LiveWords > maxLiveWords )
+
+            for ( auto successor : successors(component) ) {
+                if ( --references[successor] == 0 ) {
+                    budget->LiveWords -= reaches[successor].listWords();
+                    reaches[successor] = {};
+                } //if ( --references[successor] == 0 )
+            } //for ( auto successor : successors(component) )
+
+            for ( ; nextStart != startsOfComponents.end() && nextStart->first == component; ++nextStart ) {
+                ret = std::max(ret, energize(nextStart->second, &reach));
+            } //for ( ; nextStart != startsOfComponents.end() && nextStart->first == component; ++nextStart )
+
+            if ( references[component] == 0 ) {
+                budget->LiveWords -= reach.listWords();
+                reach              = {};
+            } //if ( references[component] == 0 )
+        } //for ( std::uint32_t component = 0; component < componentCount; ++component )
+        return ret;
     }
 
-    char mapEntry(Coordinate pos) noexcept {
-        return Map[pos.Row][pos.Column];
+    private:
+    static constexpr std::uint32_t noNode = std::numeric_limits<std::uint32_t>::max();
+
+    struct Node {
+        std::array<std::uint32_t, 2> Targets;
+        //! Die Felder beider Abschnitte.
+        std::vector<std::uint32_t>   Cells;
+    };
+
+    struct Bitset {
+        std::vector<std::uint64_t> Bits;
+        std::int64_t               Count = 0;
+    };
+
+    /**
+     * @brief Die Wörter aller lebenden Mengen. Jedes Bitset hält das Budget selbst fest, so gibt es das Budget noch,
+     * wenn die letzte Menge freigegeben wird, egal wann das passiert.
+     */
+    struct ReachBudget {
+        std::size_t LiveWords = 0;
+    };
+
+    /**
+     * @brief Die Felder, die von einer Komponente aus beleuchtet werden.
+     *
+     * Fast alles vor einer großen Schleife beleuchtet auch die ganze Schleife. Diese Mengen teilen sich daher das
+     * Bitset der Schleife und halten nur die übrigen Felder als sortierte Liste, ein neues Bitset entsteht nur, wenn
+     * verschiedene zusammenkommen oder die Liste zu lang wird.
+     */
+    struct Reach {
+        //! Kann nullptr sein.
+        std::shared_ptr<const Bitset> Base;
+        //! Nur Felder, die nicht in Base sind.
+        std::vector<std::uint32_t>    Cells;
+
+        std::int64_t count(void) const noexcept {
+            return (Base ? Base->Count : 0) + static_cast<std::int64_t>(Cells.size());
+        }
+
+        std::size_t listWords(void) const noexcept {
+            return (Cells.size() + 1) / 2;
+        }
+
+        bool inBase(std::uint32_t cell) const noexcept {
+            return Base && (Base->Bits[cell / 64] >> (cell % 64) & 1);
+        }
+    };
+
+    const std::vector<std::string_view>& Map;
+    const std::size_t                    RowCount;
+    const std::size_t                    ColumnCount;
+    const std::size_t                    Words;
+
+    std::vector<std::uint32_t> NodeOfCell;
+    std::vector<Node>          Nodes;
+    std::vector<std::uint32_t> ComponentOfNode;
+    //! Die Knoten nach Komponente, ComponentOffsets[c] bis ComponentOffsets[c + 1] gehören zu c.
+    std::vector<std::uint32_t> ComponentMembers;
+    std::vector<std::size_t>   ComponentOffsets;
+    //! Die anderen Komponenten, in die eine Komponente führt, jede nur einmal.
+    std::vector<std::uint32_t> Successors;
+    std::vector<std::size_t>   SuccessorOffsets;
+
+    std::span<const std::uint32_t> members(std::uint32_t component) const noexcept {
+        return {ComponentMembers.data() + ComponentOffsets[component],
+                ComponentMembers.data() + ComponentOffsets[component + 1]};
     }
 
-    std::int64_t moveLeft(Coordinate pos) noexcept {
-        switch ( mapEntry(pos) ) {
-            case '|' : {
-                return checkValidAndEnergize(pos.up(), Direction::Up) +
-                       checkValidAndEnergize(pos.down(), Direction::Down);
-            } //case '|'
-
-            case '-' :
-            case '.'  : return checkValidAndEnergize(pos.left(), Direction::Left);
-
-            case '\\' : return checkValidAndEnergize(pos.up(), Direction::Up);
-            case '/'  : return checkValidAndEnergize(pos.down(), Direction::Down);
-        } //switch ( mapEntry(pos) )
-        throwIfInvalid(false);
-        return 0;
+    std::span<const std::uint32_t> successors(std::uint32_t component) const noexcept {
+        return {Successors.data() + SuccessorOffsets[component], Successors.data() + SuccessorOffsets[component + 1]};
     }
 
-    std::int64_t moveRight(Coordinate pos) noexcept {
-        switch ( mapEntry(pos) ) {
-            case '|' : {
-                return checkValidAndEnergize(pos.up(), Direction::Up) +
-                       checkValidAndEnergize(pos.down(), Direction::Down);
-            } //case '|'
-
-            case '-' :
-            case '.'  : return checkValidAndEnergize(pos.right(), Direction::Right);
-
-            case '/'  : return checkValidAndEnergize(pos.up(), Direction::Up);
-            case '\\' : return checkValidAndEnergize(pos.down(), Direction::Down);
-        } //switch ( mapEntry(pos) )
-        throwIfInvalid(false);
-        return 0;
+    /**
+     * @brief Vereinigt die Felder der Komponente mit den Mengen ihrer Nachfolger.
+     * @param[in] budget Ein neues Bitset zählt zu den lebenden Wörtern, bis es wieder frei wird.
+     */
+    Reach collect(std::uint32_t component, const std::vector<Reach>& reaches,
+                  const std::shared_ptr<ReachBudget>& budget) const {
+        const auto makeBitset = [&budget](const std::vector<std::uint64_t>& bits) {
+            budget->LiveWords += bits.size();
+            return std::shared_ptr<Bitset>{new Bitset{bits, 0}, [budget](Bitset* bitset) noexcept {
+                                               budget->LiveWords -= bitset->Bits.size();
+                                               delete bitset;
+                                               return;
+                                           }};
+        };
+
+        std::shared_ptr<const Bitset> base;
+        std::shared_ptr<Bitset>       merged;
+        std::vector<const Bitset*>    mergedBases;
+        std::vector<std::uint32_t>    cells;
+        for ( auto successor : successors(component) ) {
+            const auto& successorBase = reaches[successor].Base;
+            if ( !successorBase || successorBase == base || std::ranges::contains(mergedBases, successorBase.get()) ) {
+                continue;
+            } //if ( !successorBase || successorBase == base || ... )
+
+            if ( !base ) {
+                base = successorBase;
+                continue;
+            } //if ( !base )
+
+            if ( !merged ) {
+                mergedBases.push_back(base.get());
+                merged = makeBitset(base->Bits);
+                base   = merged;
+            } //if ( !merged )
+            mergedBases.push_back(successorBase.get());
+            for ( auto&& [word, successorWord] : std::views::zip(merged->Bits, successorBase->Bits) ) {
+                word |= successorWord;
+            } //for ( auto&& [word, successorWord] : std::views::zip(merged->Bits, successorBase->Bits) )
+        } //for ( auto successor : successors(component) )
+        if ( merged ) {
+            merged->Count = countBits(merged->Bits);
+        } //if ( merged )
+
+        for ( auto member : members(component) ) {
+            cells.insert(cells.end(), Nodes[member].Cells.begin(), Nodes[member].Cells.end());
+        } //for ( auto member : members(component) )
+        for ( auto successor : successors(component) ) {
+            const auto& successorCells = reaches[successor].Cells;
+            cells.insert(cells.end(), successorCells.begin(), successorCells.end());
+        } //for ( auto successor : successors(component) )
+        std::ranges::sort(cells);
+        const auto duplicates = std::ranges::unique(cells);
+        cells.erase(duplicates.begin(), duplicates.end());
+
+        Reach ret{std::move(base), {}};
+        std::erase_if(cells, [&ret](std::uint32_t cell) noexcept { return ret.inBase(cell); });
+
+        //Ab einem halben Bitset ist die Liste größer als das Bitset selbst.
+        if ( cells.size() >= Words / 2 ) {
+            if ( !merged ) {
+                merged        = makeBitset(ret.Base ? ret.Base->Bits : std::vector<std::uint64_t>(Words));
+                merged->Count = ret.Base ? ret.Base->Count : 0;
+            } //if ( !merged )
+            for ( auto cell : cells ) {
+                merged->Bits[cell / 64] |= std::uint64_t{1} << (cell % 64);
+            } //for ( auto cell : cells )
+            merged->Count += static_cast<std::int64_t>(cells.size());
+            ret.Base       = std::move(merged);
+            cells.clear();
+        } //if ( cells.size() >= Words / 2 )
+        ret.Cells = std::move(cells);
+        return ret;
     }
 
-    std::int64_t moveUp(Coordinate pos) noexcept {
-        switch ( mapEntry(pos) ) {
-            case '-' : {
-                return checkValidAndEnergize(pos.left(), Direction::Left) +
-                       checkValidAndEnergize(pos.right(), Direction::Right);
-            } //case '-'
-
-            case '|' :
-            case '.'  : return checkValidAndEnergize(pos.up(), Direction::Up);
-
-            case '/'  : return checkValidAndEnergize(pos.right(), Direction::Right);
-            case '\\' : return checkValidAndEnergize(pos.left(), Direction::Left);
-        } //switch ( mapEntry(pos) )
-        throwIfInvalid(false);
-        return 0;
+    /**
+     * @brief Verfolgt einen Abschnitt bis zum Rand oder zum nächsten Splitter, der ihn teilt.
+     * @return Der Splitter, an dem der Abschnitt endet, oder noNode.
+     */
+    std::uint32_t trace(Coordinate pos, Direction dir, std::vector<std::uint32_t>& cells) const {
+        const auto start    = pos;
+        const auto startDir = dir;
+
+        //Durch die Größe ohne Vorzeichen sind auch die Positionen links und über der Karte zu groß.
+        while ( pos.Row < RowCount && pos.Column < ColumnCount ) {
+            const auto cell = static_cast<std::uint32_t>(pos.Row * ColumnCount + pos.Column);
+            cells.push_back(cell);
+
+            const auto [next, split] = deflect(Map[pos.Row][pos.Column], dir);
+            if ( split ) {
+                return NodeOfCell[cell];
+            } //if ( split )
+
+            dir = next;
+            pos = move(pos, dir);
+            //Ohne Teilung ist der Weg umkehrbar, eine Schleife muss also wieder am Anfang ankommen.
+            if ( pos == start && dir == startDir ) {
+                return noNode;
+            } //if ( pos == start && dir == startDir )
+        } //while ( pos.Row < RowCount && pos.Column < ColumnCount )
+        return noNode;
     }
 
-    std::int64_t moveDown(Coordinate pos) noexcept {
-        switch ( mapEntry(pos) ) {
-            case '-' : {
-                return checkValidAndEnergize(pos.left(), Direction::Left) +
-                       checkValidAndEnergize(pos.right(), Direction::Right);
-            } //case '-'
-
-            case '|' :
-            case '.'  : return checkValidAndEnergize(pos.down(), Direction::Down);
-
-            case '\\' : return checkValidAndEnergize(pos.right(), Direction::Right);
-            case '/'  : return checkValidAndEnergize(pos.left(), Direction::Left);
-        } //switch ( mapEntry(pos) )
-        throwIfInvalid(false);
-        return 0;
+    /**
+     * @brief Findet die Komponenten iterativ mit Tarjan und danach ihre Nachfolger. Die Nummern der Komponenten
+     * folgen dem Abschluss, die Nachfolger haben also immer kleinere.
+     */
+    void condense(void) {
+        constexpr std::uint32_t unvisited = noNode;
+
+        struct Frame {
+            std::uint32_t Node;
+            std::size_t   NextTarget;
+        };
+
+        std::vector<std::uint32_t> index(Nodes.size(), unvisited);
+        std::vector<std::uint32_t> lowLink(Nodes.size());
+        std::vector<bool>          onStack(Nodes.size());
+        std::vector<std::uint32_t> stack;
+        std::vector<Frame>         frames;
+        std::uint32_t              nextIndex = 0;
+
+        ComponentOfNode.assign(Nodes.size(), noNode);
+        ComponentMembers.clear();
+        ComponentMembers.reserve(Nodes.size());
+        ComponentOffsets.assign(1, 0);
+
+        const auto visit = [&](std::uint32_t node) {
+            index[node]   = nextIndex;
+            lowLink[node] = nextIndex;
+            ++nextIndex;
+            onStack[node] = true;
+            stack.push_back(node);
+            frames.push_back({node, 0});
+            return;
+        };
+
+        for ( std::uint32_t root = 0; root < Nodes.size(); ++root ) {
+            if ( index[root] != unvisited ) {
+                continue;
+            } //if ( index[root] != unvisited )
+
+            visit(root);
+            while ( !frames.empty() ) {
+                const auto [node, nextTarget] = frames.back();
+                if ( nextTarget < Nodes[node].Targets.size() ) {
+                    ++frames.back().NextTarget;
+                    const auto target = Nodes[node].Targets[nextTarget];
+                    if ( target == noNode ) {
+                        continue;
+                    } //if ( target == noNode )
+
+                    if ( index[target] == unvisited ) {
+                        visit(target);
+                    } //if ( index[target] == unvisited )
+                    else if ( onStack[target] ) {
+                        lowLink[node] = std::min(lowLink[node], index[target]);
+                    } //else if ( onStack[target] )
+                    continue;
+                } //if ( nextTarget < Nodes[node].Targets.size() )
+
+                frames.pop_back();
+                if ( !frames.empty() ) {
+                    const auto parent = frames.back().Node;
+                    lowLink[parent]   = std::min(lowLink[parent], lowLink[node]);
+                } //if ( !frames.empty() )
+
+                if ( lowLink[node] == index[node] ) {
+                    const auto    component = static_cast<std::uint32_t>(ComponentOffsets.size() - 1);
+                    std::uint32_t member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member]         = false;
+                        ComponentOfNode[member] = component;
+                        ComponentMembers.push_back(member);
+                    } while ( member != node );
+                    ComponentOffsets.push_back(ComponentMembers.size());
+                } //if ( lowLink[node] == index[node] )
+            } //while ( !frames.empty() )
+        } //for ( std::uint32_t root = 0; root < Nodes.size(); ++root )
+
+        const auto                 componentCount = ComponentOffsets.size() - 1;
+        std::vector<std::uint32_t> lastSeenFrom(componentCount, noNode);
+        Successors.clear();
+        SuccessorOffsets.assign(1, 0);
+        for ( std::uint32_t component = 0; component < componentCount; ++component ) {
+            lastSeenFrom[component] = component;
+            for ( auto member : members(component) ) {
+                for ( auto target : Nodes[member].Targets ) {
+                    if ( target == noNode || lastSeenFrom[ComponentOfNode[target]] == component ) {
+                        continue;
+                    } //if ( target == noNode || lastSeenFrom[ComponentOfNode[target]] == component )
+                    lastSeenFrom[ComponentOfNode[target]] = component;
+                    Successors.push_back(ComponentOfNode[target]);
+                } //for ( auto target : Nodes[member].Targets )
+            } //for ( auto member : members(component) )
+            SuccessorOffsets.push_back(Successors.size());
+        } //for ( std::uint32_t component = 0; component < componentCount; ++component )
+        return;
     }
 };
-} //namespace
 
-bool challenge16(const std::vector<std::string_view>& input) {
+std::vector<std::string_view> parse(const std::vector<std::string_view>& input) {
     throwIfInvalid(!input.empty());
+    //Danach verlässt sich deflect auf gültige Felder.
+    const auto isField = [](char field) noexcept {
+        return isSplitter(field) || field == '.' || field == '/' || field == '\\';
+    };
+    for ( auto line : input ) {
+        throwIfInvalid(line.size() == input.front().size() && std::ranges::all_of(line, isField));
+    } //for ( auto line : input )
+    return input;
+}
+
+std::int64_t part1(const std::vector<std::string_view>& map) {
+    Energizer energizer{map};
+    return energizer.startEnergize();
+}
+
+/**
+ * @brief Verfolgt jeden Startpunkt einzeln, ohne pool auf dem aufrufenden Thread.
+ *
+ * Sonst holen sich die Worker des Pools die Startpunkte einzeln, die dauern unterschiedlich lang. Jeder Worker hat
+ * seinen eigenen Energizer, am Ende zählt das größte Maximum.
+ */
+std::int64_t energizeEach(const std::vector<std::string_view>& map, const std::vector<Energizer::Beam>& starts,
+                          ThreadPool* pool) {
+    if ( !pool ) {
+        Energizer    energizer{map};
+        std::int64_t ret = 0;
+        for ( const auto& [position, direction] : starts ) {
+            ret = std::max(ret, energizer.startEnergize(position, direction));
+        } //for ( const auto& [position, direction] : starts )
+        return ret;
+    } //if ( !pool )
+
+    const auto                workers = std::min(pool->size(), starts.size());
+    std::vector<std::int64_t> maxima(workers);
+    std::atomic_size_t        nextStart{0};
+    std::latch                done{static_cast<std::ptrdiff_t>(workers)};
+    for ( std::size_t worker = 0; worker < workers; ++worker ) {
+        pool->submit([&map, &starts, &nextStart, &done, &maximum = maxima[worker]](void) noexcept {
+            Energizer    energizer{map};
+            std::int64_t max = 0;
+            for ( auto i = nextStart++; i < starts.size(); i = nextStart++ ) {
+                max = std::max(max, energizer.startEnergize(starts[i].Position, starts[i].Dir));
+            } //for ( auto i = nextStart++; i < starts.size(); i = nextStart++ )
+            maximum = max;
+            done.count_down();
+            return;
+        });
+    } //for ( std::size_t worker = 0; worker < workers; ++worker )
+    done.wait();
+    return std::ranges::max(maxima);
+}
+
+std::vector<Energizer::Beam> edgeStarts(const std::vector<std::string_view>& map) {
+    const auto                   rowCount    = map.size();
+    const auto                   columnCount = map.front().size();
+    std::vector<Energizer::Beam> ret;
+    ret.reserve(2 * (rowCount + columnCount));
+    for ( std::size_t column = 0; column < columnCount; ++column ) {
+        ret.push_back({{0, column}, Direction::Down});
+        ret.push_back({{rowCount - 1, column}, Direction::Up});
+    } //for ( std::size_t column = 0; column < columnCount; ++column )
+    for ( std::size_t row = 0; row < rowCount; ++row ) {
+        ret.push_back({{row, 0}, Direction::Right});
+        ret.push_back({{row, columnCount - 1}, Direction::Left});
+    } //for ( std::size_t row = 0; row < rowCount; ++row )
+    return ret;
+}
+
+std::int64_t part2(const std::vector<std::string_view>& map) {
+    const auto      starts = edgeStarts(map);
+    const BeamGraph graph{map};
+    if ( const auto ret = graph.maxEnergized(starts, defaultReachWords) ) {
+        return *ret;
+    } //if ( const auto ret = graph.maxEnergized(starts, defaultReachWords) )
+
+    //Mit dem Graphen ist ein Startpunkt nur noch sein erster Abschnitt, das lohnt keine Threads. Die braucht es erst,
+    //wenn zu viele Bitsets gleichzeitig leben müssten und doch jeder Startpunkt einzeln verfolgt wird.
+    if ( const auto jobs = challengeJobs(); jobs > 1 ) {
+        ThreadPool pool{jobs};
+        return energizeEach(map, starts, &pool);
+    } //if ( const auto jobs = challengeJobs(); jobs > 1 )
+    return energizeEach(map, starts, nullptr);
+}
+} //namespace
+
+EdgeSweep sweepEdges(const std::vector<std::string_view>& input, ThreadPool* pool, std::size_t maxReachWords) {
+    const auto      map    = parse(input);
+    const auto      starts = edgeStarts(map);
+    const BeamGraph graph{map};
+    if ( const auto ret = graph.maxEnergized(starts, maxReachWords) ) {
+        return {*ret, true};
+    } //if ( const auto ret = graph.maxEnergized(starts, maxReachWords) )
+    return {energizeEach(map, starts, pool), false};
+}
 
-    Energizer    energizer{input};
-    std::int64_t sum1 = energizer.startEnergize();
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-
-    std::int64_t sum2 = std::ranges::max(
-        std::views::iota(0uz, energizer.ColumnCount) | std::views::transform([&energizer](std::size_t column) noexcept {
-            return std::max(energizer.startEnergize({0, column}, Direction::Down),
-                            energizer.startEnergize({energizer.RowCount - 1, column}, Direction::Up));
-        }));
-    sum2 = std::max(sum2, std::ranges::max(std::views::iota(0uz, energizer.RowCount) |
-                                           std::views::transform([&energizer](std::size_t row) noexcept {
-                                               return std::max(energizer.startEnergize({row, 0}, Direction::Right),
-                                                               energizer.startEnergize({row, energizer.ColumnCount - 1},
-                                                                                       Direction::Left));
-                                           })));
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-
-    return sum1 == 8021 && sum2 == 8216;
+const Challenge& challenge16(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(16, 8021, 8216);
+    return challenge;
 }
@@ -1,9 +1,42 @@
 #ifndef CHALLENGE16_HPP
 #define CHALLENGE16_HPP
 
+#include "challenge.hpp"
+
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
-bool challenge16(const std::vector<std::string_view>& input);
+class ThreadPool;
+
+const Challenge& challenge16(void) noexcept;
+
+/**
+ * @brief Wie viele Wörter die gleichzeitig lebenden Bitsets des Strahlengraphen normal belegen dürfen, 128 MiB.
+ */
+inline constexpr std::size_t defaultReachWords = 1uz << 24;
+
+/**
+ * @brief Das Ergebnis von sweepEdges.
+ */
+struct EdgeSweep {
+    //! Die meisten beleuchteten Felder über alle Startpunkte am Rand, wie Teil 2 der Challenge.
+    std::int64_t MaxEnergized  = 0;
+    //! Ob der Strahlengraph gereicht hat, sonst wurde jeder Startpunkt einzeln verfolgt.
+    bool         UsedBeamGraph = false;
+};
+
+/**
+ * @brief Teil 2 der Challenge, mit Auskunft welcher Weg genommen wurde.
+ *
+ * Brauchen die Bitsets des Graphen mehr als maxReachWords Wörter gleichzeitig, wird jeder Startpunkt einzeln verfolgt,
+ * mit pool auf dessen Workern. Wie bei routeCrucibles darf der Aufruf dann nicht selbst aus einem davon kommen.
+ * @param[in] input Die Karte im Format der Challenge.
+ * @param[in] pool Kann nullptr sein, dann bleibt alles auf dem aufrufenden Thread.
+ * @return Wirft bei ungültiger Karte.
+ */
+EdgeSweep sweepEdges(const std::vector<std::string_view>& input, ThreadPool* pool,
+                     std::size_t maxReachWords = defaultReachWords);
 
 #endif //CHALLENGE16_HPP
@@ -1,198 +1,285 @@
 #include "challenge17.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
+#include "threadpool.hpp"
 
 #include <algorithm>
-#include <queue>
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
 
 using namespace std::string_view_literals;
 
 namespace {
-enum class Direction { Up, Left, Down, Right };
-
-Direction turnLeft(Direction d) noexcept {
-    return static_cast<Direction>((static_cast<int>(d) + 4 - 1) % 4);
-}
-
-Direction turnRight(Direction d) noexcept {
-    return static_cast<Direction>((static_cast<int>(d) + 1) % 4);
-}
-
-struct Coordinate {
-    std::size_t Row;
-    std::size_t Column;
-
-    constexpr bool operator==(const Coordinate&) const noexcept = default;
-
-    Coordinate left(void) const noexcept {
-        return {Row, Column - 1};
-    }
-
-    Coordinate right(void) const noexcept {
-        return {Row, Column + 1};
-    }
-
-    Coordinate up(void) const noexcept {
-        return {Row - 1, Column};
-    }
-
-    Coordinate down(void) const noexcept {
-        return {Row + 1, Column};
-    }
-
-    Coordinate& move(Direction direction) noexcept {
-        switch ( direction ) {
-            using enum Direction;
-            case Left  : --Column; break;
-            case Up    : --Row; break;
-            case Right : ++Column; break;
-            case Down  : ++Row; break;
-        } //switch ( direction )
-        return *this;
-    }
-
-    Coordinate moved(Direction direction) const noexcept {
-        auto ret = *this;
-        ret.move(direction);
-        return ret;
-    }
+struct HeatLossMap {
+    std::size_t                Rows        = 0;
+    std::size_t                Columns     = 0;
+    //! Zeilenweise, ein Feld pro Byte.
+    std::vector<std::uint8_t>  HeatLoss;
+    std::uint8_t               MaxHeatLoss = 0;
+    //! Pro Feld der kleinste Wärmeverlust bis zur rechten unteren Ecke, ohne die Regeln für die Tiegel.
+    std::vector<std::uint32_t> Estimates;
 };
-} //namespace
 
-namespace std {
-template<>
-struct hash<Coordinate> {
-    size_t operator()(const Coordinate& c) const noexcept {
-        std::hash<std::size_t> h;
-        return h(c.Row << 8) ^ h(c.Column);
-    }
-};
-} //namespace std
-
-namespace {
-Coordinate Target;
-
-struct Node {
-    Coordinate   Pos;
-    Direction    LastDirection;
-    std::int64_t CurrentHeatLoss;
+/**
+ * @brief Dijkstra rückwärts vom Ziel, mit beliebigen Schritten in alle Richtungen.
+ *
+ * Jeder Weg eines Tiegels ist auch hier erlaubt, die Werte unterschätzen also nie und bilden eine konsistente
+ * Heuristik für die Suche. Ein Schritt kostet höchstens MaxHeatLoss, also reichen MaxHeatLoss + 1 Buckets.
+ */
+std::vector<std::uint32_t> estimateRemaining(const HeatLossMap& map, std::size_t target) {
+    constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<std::uint32_t>              ret(map.HeatLoss.size(), unreached);
+    std::vector<std::vector<std::uint32_t>> buckets(map.MaxHeatLoss + 1uz);
+    std::size_t                             pending = 1;
+    ret[target]                                     = 0;
+    buckets[0].push_back(static_cast<std::uint32_t>(target));
+
+    for ( std::uint32_t cost = 0; pending > 0; ++cost ) {
+        auto& bucket = buckets[cost % buckets.size()];
+        while ( !bucket.empty() ) {
+            const std::size_t field = bucket.back();
+            bucket.pop_back();
+            --pending;
+            if ( ret[field] != cost ) {
+                continue;
+            } //if ( ret[field] != cost )
+
+            //Wer von einem Nachbarn auf field geht, verliert die Wärme von field.
+            const auto viaField = cost + map.HeatLoss[field];
+            auto       relax    = [&](std::size_t neighbor) {
+                if ( viaField < ret[neighbor] ) {
+                    ret[neighbor] = viaField;
+                    buckets[viaField % buckets.size()].push_back(static_cast<std::uint32_t>(neighbor));
+                    ++pending;
+                } //if ( viaField < ret[neighbor] )
+                return;
+            };
+
+            const auto column = field % map.Columns;
+            if ( field >= map.Columns ) {
+                relax(field - map.Columns);
+            } //if ( field >= map.Columns )
+            if ( field + map.Columns < map.HeatLoss.size() ) {
+                relax(field + map.Columns);
+            } //if ( field + map.Columns < map.HeatLoss.size() )
+            if ( column > 0 ) {
+                relax(field - 1);
+            } //if ( column > 0 )
+            if ( column + 1 < map.Columns ) {
+                relax(field + 1);
+            } //if ( column + 1 < map.Columns )
+        } //while ( !bucket.empty() )
+    } //for ( std::uint32_t cost = 0; pending > 0; ++cost )
+    return ret;
+}
 
-    int distanceToTarget(void) const noexcept {
-        return static_cast<int>(Target.Row - Pos.Row + Target.Column - Pos.Column);
+/**
+ * @brief A* mit einer Bucket Queue (Dial), ohne Hashen und ohne Heap.
+ *
+ * Ein Zustand ist ein Feld und die Achse, auf der es erreicht wurde, weiter geht es nur quer dazu. Die Kosten liegen
+ * dicht in einem Array mit zwei Einträgen pro Feld. Sortiert wird nach Kosten plus Estimates des Feldes. Ein Schritt
+ * kostet höchstens maxPerDirection * MaxHeatLoss und die Schätzung kann auf dem Stück um höchstens genauso viel
+ * sinken, daher reichen doppelt so viele Buckets (plus einer) im Kreis, die zwischen den Aufrufen wiederverwendet
+ * werden.
+ *
+ * Liest die Karte nur, mehrere PathFinder können sich eine Karte zwischen Threads teilen.
+ */
+class PathFinder {
+    public:
+    explicit PathFinder(const HeatLossMap& map) : Map{map}, Costs(map.HeatLoss.size() * 2) {
+        return;
     }
-};
 
-struct Heuristic {
-    bool operator()(const Node& lhs, const Node& rhs) const noexcept {
-       return lhs.CurrentHeatLoss > rhs.CurrentHeatLoss ||
-              (lhs.CurrentHeatLoss == rhs.CurrentHeatLoss && lhs.distanceToTarget() > rhs.distanceToTarget());
+    /**
+     * @param[in] estimates Von estimateRemaining für target.
+     * @param[in] minPerDirection Erst nach mehr Schritten darf abgebogen werden.
+     * @param[in] maxPerDirection Höchstens so viele Schritte in eine Richtung.
+     * @return Der kleinste Wärmeverlust, int64 max wenn target nicht erreichbar ist.
+     */
+    std::int64_t findPath(std::size_t start, std::size_t target, std::span<const std::uint32_t> estimates,
+                          int minPerDirection, int maxPerDirection) {
+        if ( start == target ) {
+            return 0;
+        } //if ( start == target )
+
+        const auto minSteps = static_cast<std::size_t>(minPerDirection);
+        const auto maxSteps = static_cast<std::size_t>(maxPerDirection);
+        Estimates           = estimates;
+
+        Buckets.resize(2 * maxSteps * Map.MaxHeatLoss + 1);
+        for ( auto& bucket : Buckets ) {
+            bucket.clear();
+        } //for ( auto& bucket : Buckets )
+        std::ranges::fill(Costs, unreached);
+        Pending = 0;
+
+        //Am Anfang darf man in beide Richtungen, als wäre man auf beiden Achsen angekommen.
+        push(start * 2 + Horizontal, 0);
+        push(start * 2 + Vertical, 0);
+
+        //Die Schätzung ist zulässig, ab dem Bucket mit ret kann es also nicht mehr besser werden.
+        std::uint32_t ret = unreached;
+        for ( std::uint32_t priority = Estimates[start]; Pending > 0 && priority < ret; ++priority ) {
+            auto& bucket = Buckets[priority % Buckets.size()];
+            while ( !bucket.empty() ) {
+                const auto state = bucket.back();
+                bucket.pop_back();
+                --Pending;
+
+                //Wurde der Zustand seitdem billiger erreicht, liegt er schon in einem früheren Bucket.
+                const std::size_t field = state / 2;
+                const auto        cost  = Costs[state];
+                if ( cost + Estimates[field] != priority ) {
+                    continue;
+                } //if ( cost + Estimates[field] != priority )
+
+                const std::size_t row    = field / Map.Columns;
+                const std::size_t column = field % Map.Columns;
+
+                auto walk = [&](std::ptrdiff_t delta, std::size_t available, Axis axis) noexcept {
+                    auto position = field;
+                    auto walked   = cost;
+                    for ( std::size_t step = 1; step <= std::min(available, maxSteps); ++step ) {
+                        position = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(position) + delta);
+                        walked  += Map.HeatLoss[position];
+
+                        if ( position == target ) {
+                            ret = std::min(ret, walked);
+                            break;
+                        } //if ( position == target )
+
+                        if ( step > minSteps ) {
+                            push(position * 2 + axis, walked);
+                        } //if ( step > minSteps )
+                    } //for ( std::size_t step = 1; step <= std::min(available, maxSteps); ++step )
+                    return;
+                };
+
+                if ( state % 2 == Horizontal ) {
+                    const auto columns = static_cast<std::ptrdiff_t>(Map.Columns);
+                    walk(-columns, row, Vertical);
+                    walk(columns, Map.Rows - 1 - row, Vertical);
+                } //if ( state % 2 == Horizontal )
+                else {
+                    walk(-1, column, Horizontal);
+                    walk(1, Map.Columns - 1 - column, Horizontal);
+                } //else -> if ( state % 2 == Horizontal )
+            } //while ( !bucket.empty() )
+        } //for ( std::uint32_t priority = Estimates[start]; Pending > 0 && priority < ret; ++priority )
+        return ret == unreached ? std::numeric_limits<std::int64_t>::max() : ret;
     }
-};
 
-struct Hasher {
-    std::size_t operator()(const Node& node) const noexcept {
-        std::hash<Coordinate> c;
-        std::hash<Direction>  d;
-        return (c(node.Pos) << 8) ^ d(node.LastDirection);
-    }
-};
+    private:
+    enum Axis : std::size_t { Horizontal, Vertical };
 
-struct KindOfEquality {
-    bool operator()(const Node& lhs, const Node& rhs) const noexcept {
-        return lhs.Pos == rhs.Pos && lhs.LastDirection == rhs.LastDirection;
-    }
-};
+    static constexpr std::uint32_t unreached = std::numeric_limits<std::uint32_t>::max();
 
-struct PathFinder {
-    const std::vector<std::vector<std::int8_t>>                    HeatLossMap;
-    std::priority_queue<Node, std::vector<Node>, Heuristic>        NodesToVisit;
-    std::unordered_map<Node, std::int64_t, Hasher, KindOfEquality> Visited;
+    const HeatLossMap&                      Map;
+    //! Pro Feld zwei Einträge, Index ist Feld * 2 + Achse.
+    std::vector<std::uint32_t>              Costs;
+    std::vector<std::vector<std::uint32_t>> Buckets;
+    std::size_t                             Pending = 0;
+    std::span<const std::uint32_t>          Estimates;
 
-    PathFinder(std::vector<std::vector<std::int8_t>> heatLossMap) noexcept : HeatLossMap{std::move(heatLossMap)} {
-        Target = {HeatLossMap.size() - 1, HeatLossMap.front().size() - 1};
+    void push(std::size_t state, std::uint32_t cost) {
+        if ( cost < Costs[state] ) {
+            Costs[state] = cost;
+            Buckets[(cost + Estimates[state / 2]) % Buckets.size()].push_back(static_cast<std::uint32_t>(state));
+            ++Pending;
+        } //if ( cost < Costs[state] )
         return;
     }
+};
 
-    bool isValid(const Coordinate& pos) const noexcept {
-        return pos.Row <= Target.Row && pos.Column <= Target.Column;
-    }
-
-    std::int64_t findPath(int minPerDirection, int maxPerDirection) noexcept {
-        while ( !NodesToVisit.empty() ) {
-            NodesToVisit.pop();
-        } //while ( !NodesToVisit.empty() )
-        Visited.clear();
-
-        NodesToVisit.emplace(Coordinate{0, 1}, Direction::Right, 0);
-        NodesToVisit.emplace(Coordinate{1, 0}, Direction::Down, 0);
+HeatLossMap parse(const std::vector<std::string_view>& input) {
+    throwIfInvalid(!input.empty() && !input.front().empty());
+    HeatLossMap ret;
+    ret.Rows    = input.size();
+    ret.Columns = input.front().size();
+    //Die Zustände, Kosten und Schätzungen werden mit 32 Bit gezählt.
+    throwIfInvalid(ret.Rows * ret.Columns * 3 * 9 < std::numeric_limits<std::uint32_t>::max());
+    ret.HeatLoss.reserve(ret.Rows * ret.Columns);
+
+    for ( auto line : input ) {
+        throwIfInvalid(line.size() == ret.Columns);
+        for ( char c : line ) {
+            throwIfInvalid(isDigit(c));
+            ret.HeatLoss.push_back(static_cast<std::uint8_t>(c - '0'));
+        } //for ( char c : line )
+    } //for ( auto line : input )
+    ret.MaxHeatLoss = std::ranges::max(ret.HeatLoss);
+    //Einmal für beide Teile.
+    ret.Estimates   = estimateRemaining(ret, ret.HeatLoss.size() - 1);
+    return ret;
+}
 
-        std::int64_t ret = std::numeric_limits<std::int64_t>::max();
+std::int64_t part1(const HeatLossMap& heatLossMap) {
+    PathFinder pathFinder{heatLossMap};
+    return pathFinder.findPath(0, heatLossMap.HeatLoss.size() - 1, heatLossMap.Estimates, 0, 3);
+}
 
-        while ( !NodesToVisit.empty() ) {
-            auto currentNode = NodesToVisit.top();
-            NodesToVisit.pop();
+std::int64_t part2(const HeatLossMap& heatLossMap) {
+    PathFinder pathFinder{heatLossMap};
+    return pathFinder.findPath(0, heatLossMap.HeatLoss.size() - 1, heatLossMap.Estimates, 3, 10);
+}
+} //namespace
 
-            auto iter = Visited.find(currentNode);
-            if ( iter != Visited.end() && iter->second <= currentNode.CurrentHeatLoss ) {
-                continue;
-            } //if ( iter != Visited.end() && iter->second <= currentNode.CurrentHeatLoss )
-
-            if ( iter == Visited.end() ) {
-                Visited.insert({currentNode, currentNode.CurrentHeatLoss});
-            } //if ( iter == Visited.end() )
-            else {
-                iter->second = currentNode.CurrentHeatLoss;
-            } //else -> if ( iter == Visited.end() )
-
-            for ( int stepsDone = 0; stepsDone < maxPerDirection; ++stepsDone ) {
-                if ( !isValid(currentNode.Pos) ) {
-                    break;
-                } //if ( !isValid(currentNode.Pos) )
-
-                currentNode.CurrentHeatLoss += HeatLossMap[currentNode.Pos.Row][currentNode.Pos.Column];
-
-                if ( currentNode.Pos == Target ) {
-                    ret = std::min(ret, currentNode.CurrentHeatLoss);
-                    break;
-                } //if ( currentNode.Pos == Target )
-
-                if ( stepsDone >= minPerDirection ) {
-                    for ( auto dir : {turnLeft(currentNode.LastDirection), turnRight(currentNode.LastDirection)} ) {
-                        NodesToVisit.emplace(currentNode.Pos.moved(dir), dir, currentNode.CurrentHeatLoss);
-                    } //for ( auto dir : {turnLeft(currentNode.LastDirection), turnRight(currentNode.LastDirection)} )
-                } //if ( stepsDone >= minPerDirection )
-
-                currentNode.Pos.move(currentNode.LastDirection);
-            } //for ( int stepsDone = 0; stepsDone < maxPerDirection; ++stepsDone )
-        } //while ( !NodesToVisit.empty() )
+std::vector<std::int64_t> routeCrucibles(const std::vector<std::string_view>& input,
+                                         std::span<const CrucibleQuery> queries, ThreadPool& pool) {
+    const auto map = parse(input);
+    for ( const auto& query : queries ) {
+        throwIfInvalid(query.StartRow < map.Rows && query.StartColumn < map.Columns && query.TargetRow < map.Rows &&
+                       query.TargetColumn < map.Columns);
+        throwIfInvalid(query.MinPerDirection >= 0 && query.MaxPerDirection > query.MinPerDirection);
+    } //for ( const auto& query : queries )
+
+    std::vector<std::int64_t> ret(queries.size());
+    if ( queries.empty() ) {
         return ret;
-    }
-};
+    } //if ( queries.empty() )
 
-auto convert(const std::vector<std::string_view>& input) noexcept {
-    std::vector<std::vector<std::int8_t>> ret;
-    ret.resize(input.size());
-    std::ranges::transform(input, ret.begin(), [](std::string_view line) noexcept {
-        std::vector<std::int8_t> lineRet;
-        lineRet.resize(line.size());
-        std::ranges::transform(line, lineRet.begin(), [](char c) noexcept { return c - '0'; });
-        return lineRet;
+    //Nach Ziel sortiert, dann kann ein Worker die Schätzung meistens für die nächste Anfrage weiterverwenden.
+    std::vector<std::size_t> order(queries.size());
+    std::iota(order.begin(), order.end(), 0uz);
+    std::ranges::sort(order, {}, [&queries](std::size_t index) noexcept {
+        return std::pair{queries[index].TargetRow, queries[index].TargetColumn};
     });
+
+    //Jeder Worker hat seine eigenen Arrays und holt sich die Anfragen einzeln, die dauern unterschiedlich lang.
+    const auto         workers = std::min(pool.size(), queries.size());
+    std::atomic_size_t nextQuery{0};
+    std::latch         done{static_cast<std::ptrdiff_t>(workers)};
+    for ( std::size_t worker = 0; worker < workers; ++worker ) {
+        pool.submit([&map, &queries, &order, &nextQuery, &ret, &done](void) noexcept {
+            PathFinder                 pathFinder{map};
+            std::vector<std::uint32_t> estimates;
+            auto                       estimatesFor = std::numeric_limits<std::size_t>::max();
+            for ( auto i = nextQuery++; i < order.size(); i = nextQuery++ ) {
+                const auto& query  = queries[order[i]];
+                const auto  start  = query.StartRow * map.Columns + query.StartColumn;
+                const auto  target = query.TargetRow * map.Columns + query.TargetColumn;
+                if ( target != estimatesFor ) {
+                    estimates    = estimateRemaining(map, target);
+                    estimatesFor = target;
+                } //if ( target != estimatesFor )
+                ret[order[i]] = pathFinder.findPath(start, target, estimates, query.MinPerDirection, query.MaxPerDirection);
+            } //for ( auto i = nextQuery++; i < order.size(); i = nextQuery++ )
+            done.count_down();
+            return;
+        });
+    } //for ( std::size_t worker = 0; worker < workers; ++worker )
+    done.wait();
     return ret;
 }
-} //namespace
-
-bool challenge17(const std::vector<std::string_view>& input) {
-    throwIfInvalid(!input.empty());
-
-    PathFinder   pathFinder{convert(input)};
-    std::int64_t min1 = pathFinder.findPath(0, 3);
-    myPrint(" == Result of Part 1: {:d} ==\n", min1);
-
-    std::int64_t min2 = pathFinder.findPath(3, 10);
-    myPrint(" == Result of Part 2: {:d} ==\n", min2);
 
-    return min1 == 1004 && min2 == 1171;
+const Challenge& challenge17(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(17, 1004, 1171);
+    return challenge;
 }
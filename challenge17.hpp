@@ -1,9 +1,43 @@
 #ifndef CHALLENGE17_HPP
 #define CHALLENGE17_HPP
 
+#include "challenge.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
 #include <vector>
 
-bool challenge17(const std::vector<std::string_view>& input);
+class ThreadPool;
+
+const Challenge& challenge17(void) noexcept;
+
+/**
+ * @brief Eine Anfrage an routeCrucibles, Zeilen und Spalten zählen ab 0.
+ */
+struct CrucibleQuery {
+    std::size_t StartRow        = 0;
+    std::size_t StartColumn     = 0;
+    std::size_t TargetRow       = 0;
+    std::size_t TargetColumn    = 0;
+    //! Erst nach mehr Schritten in eine Richtung darf abgebogen werden, 0 für die normalen, 3 für die ultra Tiegel.
+    int         MinPerDirection = 0;
+    //! Höchstens so viele Schritte in eine Richtung, 3 für die normalen, 10 für die ultra Tiegel.
+    int         MaxPerDirection = 3;
+};
+
+/**
+ * @brief Beantwortet viele Anfragen über dieselbe Karte parallel auf den Workern von pool.
+ *
+ * Die Karte wird einmal gelesen und von allen Workern geteilt, jeder Worker hat seine eigenen Arrays für die Suche.
+ * Wie in der Challenge ist das Ziel erreicht, sobald ein Tiegel es betritt. Gewartet wird nur auf die eigenen
+ * Aufgaben, der Pool kann also nebenher anderes tun, nur darf der Aufruf nicht selbst aus einem seiner Worker kommen.
+ * @param[in] input Die Karte im Format der Challenge.
+ * @return Pro Anfrage der kleinste Wärmeverlust, int64 max wenn das Ziel nicht erreichbar ist. Wirft bei ungültiger
+ * Karte oder Anfrage.
+ */
+std::vector<std::int64_t> routeCrucibles(const std::vector<std::string_view>& input,
+                                         std::span<const CrucibleQuery> queries, ThreadPool& pool);
 
 #endif //CHALLENGE17_HPP
@@ -1,7 +1,6 @@
 #include "challenge18.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
@@ -92,7 +91,7 @@ struct DigAction {
 using ParseResult = std::vector<DigAction>;
 
 template<bool UseColor>
-ParseResult parse(const std::vector<std::string_view>& input) {
+ParseResult parseActions(const std::vector<std::string_view>& input) {
     ParseResult ret;
     ret.reserve(input.size());
     for ( const auto line : input ) {
@@ -125,7 +124,7 @@ ParseResult parse(const std::vector<std::string_view>& input) {
     return ret;
 }
 
-std::int64_t dig(const ParseResult& input) noexcept {
+std::int64_t dig(const ParseResult& input) {
     const auto coordinateAndMove = [current = Coordinate<std::int64_t>{0, 0}](const DigAction& dig) mutable noexcept {
         return current.move(dig.Direction, dig.Length);
     };
@@ -145,14 +144,21 @@ std::int64_t dig(const ParseResult& input) noexcept {
     const auto perimeter = std::ranges::fold_left(input | std::views::transform(&DigAction::Length), 0, std::plus<>{});
     return innerArea + perimeter / 2 + 1;
 }
-} //namespace
 
-bool challenge18(const std::vector<std::string_view>& rawInput) {
-    auto area1 = dig(parse<false>(rawInput));
-    myPrint(" == Result of Part 1: {:d} ==\n", area1);
+std::pair<ParseResult, ParseResult> parse(const std::vector<std::string_view>& input) {
+    return {parseActions<false>(input), parseActions<true>(input)};
+}
+
+std::int64_t part1(const std::pair<ParseResult, ParseResult>& input) {
+    return dig(input.first);
+}
 
-    auto area2 = dig(parse<true>(rawInput));
-    myPrint(" == Result of Part 2: {:d} ==\n", area2);
+std::int64_t part2(const std::pair<ParseResult, ParseResult>& input) {
+    return dig(input.second);
+}
+} //namespace
 
-    return area1 == 40714 && area2 == 129'849'166'997'110;
+const Challenge& challenge18(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(18, 40714, 129'849'166'997'110);
+    return challenge;
 }
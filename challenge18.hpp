@@ -1,9 +1,8 @@
 #ifndef CHALLENGE18_HPP
 #define CHALLENGE18_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge18(const std::vector<std::string_view>& input);
+const Challenge& challenge18(void) noexcept;
 
 #endif //CHALLENGE18_HPP
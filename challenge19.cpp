@@ -1,7 +1,6 @@
 #include "challenge19.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
@@ -95,12 +94,64 @@ MetalPiece parseMetalPiece(std::string_view line) {
     return {convert(match.get<1>()), convert(match.get<2>()), convert(match.get<3>()), convert(match.get<4>())};
 }
 
+/**
+ * @brief Prüft, dass es in gibt, jedes Ziel ein Workflow oder A/R ist und die Workflows keinen Kreis bilden.
+ *
+ * Danach gehen die Teile ohne weitere Prüfung von Workflow zu Workflow und kommen immer bei A oder R an.
+ */
+void validateWorkflows(const std::unordered_map<std::string_view, Workflow>& workflows) {
+    const auto known = [&workflows](std::string_view target) noexcept {
+        return target == Accepted || target == Rejected || workflows.contains(target);
+    };
+    throwIfInvalid(workflows.contains("in"sv), "Workflow in is missing");
+    for ( const auto& workflow : workflows | std::views::values ) {
+        throwIfInvalid(known(workflow.Fallback) && std::ranges::all_of(workflow.Rules, known, &Rule::Target),
+                       "Unknown workflow");
+    } //for ( const auto& workflow : workflows | std::views::values )
+
+    //Tiefensuche, trifft sie auf einen Workflow, der noch auf dem Stack liegt, gibt es einen Kreis.
+    enum class State : bool { OnStack, Done };
+    std::unordered_map<std::string_view, State>           states;
+    std::vector<std::pair<std::string_view, std::size_t>> stack;
+    for ( auto root : workflows | std::views::keys ) {
+        if ( !states.try_emplace(root, State::OnStack).second ) {
+            continue;
+        } //if ( !states.try_emplace(root, State::OnStack).second )
+
+        stack.emplace_back(root, 0);
+        while ( !stack.empty() ) {
+            auto& [name, next]   = stack.back();
+            const auto& workflow = workflows.find(name)->second;
+            if ( next > workflow.Rules.size() ) {
+                states[name] = State::Done;
+                stack.pop_back();
+                continue;
+            } //if ( next > workflow.Rules.size() )
+
+            const auto target = next < workflow.Rules.size() ? workflow.Rules[next].Target : workflow.Fallback;
+            ++next;
+            if ( target == Accepted || target == Rejected ) {
+                continue;
+            } //if ( target == Accepted || target == Rejected )
+
+            const auto [state, inserted] = states.try_emplace(target, State::OnStack);
+            if ( inserted ) {
+                stack.emplace_back(target, 0);
+                continue;
+            } //if ( inserted )
+            throwIfInvalid(state->second == State::Done, "Workflows form a cycle");
+        } //while ( !stack.empty() )
+    } //for ( auto root : workflows | std::views::keys )
+    return;
+}
+
 Instance parse(const std::vector<std::string_view>& input) {
     const auto predicate = [](std::string_view line) noexcept { return !line.starts_with('{'); };
     Instance   ret;
     std::ranges::transform(input | std::views::take_while(predicate) |
                                std::views::take_while([](std::string_view line) noexcept { return !line.empty(); }),
                            std::inserter(ret.Workflows, ret.Workflows.end()), parseWorkflow);
+    validateWorkflows(ret.Workflows);
     std::ranges::transform(input | std::views::drop_while(predicate) | std::views::drop_while(&std::string_view::empty),
                            std::back_inserter(ret.MetalPieces), parseMetalPiece);
     return ret;
@@ -133,7 +184,9 @@ std::int64_t calcCombinations(MetalPiece min, MetalPiece max, std::string_view w
                (max.Musical - min.Musical + 1) * (max.Shiny - min.Shiny + 1);
     } //if ( workflowName == Accepted )
 
-    const auto&  workflow = workflows.find(workflowName)->second;
+    const auto workflowIter = workflows.find(workflowName);
+    checkInvariant(workflowIter != workflows.end());
+    const auto&  workflow = workflowIter->second;
     std::int64_t ret      = 0;
 
     for ( const auto& rule : workflow.Rules ) {
@@ -155,16 +208,13 @@ std::int64_t calcCombinations(MetalPiece min, MetalPiece max, std::string_view w
 
     return ret + calcCombinations(min, max, workflow.Fallback, workflows);
 }
-} //namespace
-
-bool challenge19(const std::vector<std::string_view>& input) {
-    const auto instance = parse(input);
 
+std::int64_t part1(const Instance& instance) noexcept {
     const auto accepted = [&workflows = instance.Workflows](const MetalPiece& piece) noexcept {
         auto workflowName = "in"sv;
         while ( workflowName != Accepted && workflowName != Rejected ) {
             auto workflowIter = workflows.find(workflowName);
-            throwIfInvalid(workflowIter != workflows.end());
+            checkInvariant(workflowIter != workflows.end());
             const auto& workflow    = workflowIter->second;
             bool        ruleApplied = false;
 
@@ -194,13 +244,17 @@ bool challenge19(const std::vector<std::string_view>& input) {
         return workflowName == Accepted;
     };
 
-    auto sum1 = std::ranges::fold_left(instance.MetalPieces | std::views::filter(accepted) |
-                                           std::views::transform(&MetalPiece::rating),
-                                       0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    return std::ranges::fold_left(instance.MetalPieces | std::views::filter(accepted) |
+                                      std::views::transform(&MetalPiece::rating),
+                                  0, std::plus<>{});
+}
 
-    auto sum2 = calcCombinations({1, 1, 1, 1}, {4000, 4000, 4000, 4000}, "in"sv, instance.Workflows);
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+std::int64_t part2(const Instance& instance) noexcept {
+    return calcCombinations({1, 1, 1, 1}, {4000, 4000, 4000, 4000}, "in"sv, instance.Workflows);
+}
+} //namespace
 
-    return sum1 == 377025 && sum2 == 135'506'683'246'673;
+const Challenge& challenge19(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(19, 377025, 135'506'683'246'673);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE19_HPP
 #define CHALLENGE19_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge19(const std::vector<std::string_view>& input);
+const Challenge& challenge19(void) noexcept;
 
 #endif //CHALLENGE19_HPP
@@ -1,7 +1,6 @@
 #include "challenge2.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <ranges>
@@ -17,65 +16,51 @@ struct Game {
 };
 
 std::vector<Game> parse(const std::vector<std::string_view>& input) {
-    enum class State { Game, Number, Count, Color } state = State::Game;
     std::vector<Game> ret;
-    Game*             currentGame;
-    std::int64_t      currentCount;
+    ret.reserve(input.size());
 
     for ( auto line : input ) {
-        for ( const auto& word : splitString(line, ' ') ) {
-            switch ( state ) {
-                case State::Game : {
-                    throwIfInvalid(word == "Game"sv);
-                    currentGame = &ret.emplace_back();
-                    state       = State::Number;
+        throwIfInvalid(line.starts_with("Game "sv));
+        auto& game = ret.emplace_back();
+
+        //Ein Durchgang über die Bytes: Erst die Nummer bis zum :, danach immer eine Anzahl gefolgt von der Farbe, die
+        //man am ersten Buchstaben erkennt. Der Rest der Farbe und die Trenner werden übersprungen.
+        std::int64_t count    = -1;
+        bool         inNumber = false;
+        bool         overflow = false;
+        bool         colon    = false;
+        for ( auto c : line.substr(5) ) {
+            if ( isDigit(c) ) {
+                if ( !inNumber ) {
+                    throwIfInvalid(count < 0);
+                    count    = 0;
+                    inNumber = true;
+                } //if ( !inNumber )
+                overflow |= __builtin_mul_overflow(count, 10, &count);
+                overflow |= __builtin_add_overflow(count, c - '0', &count);
+                continue;
+            } //if ( isDigit(c) )
+
+            inNumber = false;
+            if ( count < 0 || c == ' ' ) {
+                continue;
+            } //if ( count < 0 || c == ' ' )
+
+            switch ( c ) {
+                case ':' : {
+                    throwIfInvalid(!colon);
+                    game.Number = count;
+                    colon       = true;
                     break;
-                } //case State::Game
-
-                case State::Number : {
-                    currentGame->Number = convert(word);
-                    state               = State::Count;
-                    break;
-                } //case State::Number
-
-                case State::Count : {
-                    currentCount = convert(word);
-                    state        = State::Color;
-                    break;
-                } //case State::Count
-
-                case State::Color : {
-                    std::string_view colorString = word;
-                    switch ( word.back() ) {
-                        case ';' :
-                        case ',' : {
-                            colorString.remove_suffix(1);
-                            state = State::Count;
-                            break;
-                        } //case ';' & ','
-
-                        default : {
-                            state = State::Game;
-                            break;
-                        } //default
-                    } //switch ( word.back() )
-
-                    auto checkAndAssign = [&colorString, &currentCount](std::string_view check,
-                                                                        std::int64_t&    value) noexcept {
-                        if ( colorString != check ) {
-                            return false;
-                        } //if ( colorString != check )
-
-                        value = std::max(value, currentCount);
-                        return true;
-                    };
-                    throwIfInvalid(checkAndAssign("red"sv, currentGame->MaxRed) ||
-                                   checkAndAssign("blue"sv, currentGame->MaxBlue) ||
-                                   checkAndAssign("green"sv, currentGame->MaxGreen));
-                    break;
-                } //case State::Color
-            } //switch ( state )
-        } //for ( const auto& word : input )
+                } //case ':'
+                case 'r' : game.MaxRed = std::max(game.MaxRed, count); break;
+                case 'g' : game.MaxGreen = std::max(game.MaxGreen, count); break;
+                case 'b' : game.MaxBlue = std::max(game.MaxBlue, count); break;
+                default  : throwIfInvalid(false); break;
+            } //switch ( c )
+            count = -1;
+        } //for ( auto c : line.substr(5) )
+        throwIfInvalid(colon && count < 0 && !overflow);
     } //for ( auto line : input )
     return ret;
 }
@@ -87,19 +72,20 @@ bool validFilter(const Game& game) noexcept {
 auto calcPower(const Game& game) noexcept {
     return game.MaxRed * game.MaxBlue * game.MaxGreen;
 }
-} //namespace
-
-bool challenge2(const std::vector<std::string_view> &input) {
-    const std::vector<Game> games = parse(input);
 
-    auto       possibleGames      = games | std::views::filter(validFilter);
-    auto       possibleIds        = possibleGames | std::views::transform(&Game::Number);
-    const auto sum1               = std::ranges::fold_left(possibleIds, 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+std::int64_t part1(const std::vector<Game>& games) noexcept {
+    auto possibleGames = games | std::views::filter(validFilter);
+    auto possibleIds   = possibleGames | std::views::transform(&Game::Number);
+    return std::ranges::fold_left(possibleIds, 0, std::plus<>{});
+}
 
-    auto       powers = games | std::views::transform(calcPower);
-    const auto sum2   = std::ranges::fold_left(powers, 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+std::int64_t part2(const std::vector<Game>& games) noexcept {
+    auto powers = games | std::views::transform(calcPower);
+    return std::ranges::fold_left(powers, 0, std::plus<>{});
+}
+} //namespace
 
-    return sum1 == 2006 && sum2 == 84911;
+const Challenge& challenge2(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(2, 2006, 84911);
+    return challenge;
 }
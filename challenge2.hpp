@@ -1,9 +1,8 @@
 #ifndef CHALLENGE2_HPP
 #define CHALLENGE2_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge2(const std::vector<std::string_view>& input);
+const Challenge& challenge2(void) noexcept;
 
 #endif //CHALLENGE2_HPP
@@ -1,7 +1,6 @@
 #include "challenge20.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -157,7 +156,7 @@ struct Run {
         return;
     }
 
-    void applyPulse(FlipFlop& flip, ModuleName /*from*/, const Connections& receivers, Pulse pulse) noexcept {
+    void applyPulse(FlipFlop& flip, ModuleName /*from*/, const Connections& receivers, Pulse pulse) {
         if ( pulse == Pulse::High ) {
             return;
         } //if ( pulse == Pulse::High )
@@ -166,7 +165,7 @@ struct Run {
         return;
     }
 
-    void applyPulse(Conjunction& conjunction, ModuleName from, const Connections& receivers, Pulse pulse) noexcept {
+    void applyPulse(Conjunction& conjunction, ModuleName from, const Connections& receivers, Pulse pulse) {
         auto& cache = conjunction.PulseCache.find(from)->second;
         if ( cache != pulse ) {
             if ( pulse == Pulse::High ) {
@@ -188,13 +187,13 @@ struct Run {
         return;
     }
 
-    void addPulses(ModuleName sender, const Connections& receivers, Pulse pulse) noexcept {
+    void addPulses(ModuleName sender, const Connections& receivers, Pulse pulse) {
         std::ranges::copy(std::views::zip(std::views::repeat(sender), receivers, std::views::repeat(pulse)),
                           std::back_inserter(NextPulses));
         return;
     }
 
-    void press(int presses) noexcept {
+    void press(int presses) {
         for ( ; presses > 0; --presses, ++ButtonPresses ) {
             //The Button:
             ++LowPulses;
@@ -213,7 +212,7 @@ struct Run {
 
                     auto& [module, connections] = moduleIter->second;
                     std::visit(
-                        [this, &connections, pulse, sender](auto& realModule) noexcept {
+                        [this, &connections, pulse, sender](auto& realModule) {
                             applyPulse(realModule, sender, connections, pulse);
                             return;
                         },
@@ -225,25 +224,26 @@ struct Run {
         return;
     }
 };
-} //namespace
-
-bool challenge20(const std::vector<std::string_view>& input) {
-    const auto moduleConfiguration = parse(input);
 
+std::int64_t part1(const ModuleConfiguration& moduleConfiguration) {
     Run run{moduleConfiguration};
     run.press(1000);
-    auto result1 = run.LowPulses * run.HighPulses;
-    myPrint(" == Result of Part 1: {:d} ==\n", result1);
+    return run.LowPulses * run.HighPulses;
+}
 
-    run = Run{moduleConfiguration};
+std::int64_t part2(const ModuleConfiguration& moduleConfiguration) {
+    Run run{moduleConfiguration};
     throwIfInvalid(run.RxPredeccesor);
     while ( std::ranges::any_of(run.RxPredeccesor->PulseLoop, [](auto pair) noexcept { return pair.second == 0; }) ) {
         run.press(1);
     } //while ( std::ranges::any_of(run.RxPredeccesor->PulseLoop, [](auto pair) noexcept { return pair.second == 0; }) )
-    auto result = std::ranges::fold_left(run.RxPredeccesor->PulseLoop |
-                                             std::views::transform(&std::pair<const ModuleName, std::int64_t>::second),
-                                         1, std::lcm<std::int64_t, std::int64_t>);
-    myPrint(" == Result of Part 2: {:d} ==\n", result);
+    return std::ranges::fold_left(run.RxPredeccesor->PulseLoop |
+                                      std::views::transform(&std::pair<const ModuleName, std::int64_t>::second),
+                                  1, std::lcm<std::int64_t, std::int64_t>);
+}
+} //namespace
 
-    return result1 == 879'834'312 && result == 243037165713371;
+const Challenge& challenge20(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(20, 879'834'312, 243037165713371);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE20_HPP
 #define CHALLENGE20_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge20(const std::vector<std::string_view>& input);
+const Challenge& challenge20(void) noexcept;
 
 #endif //CHALLENGE20_HPP
@@ -1,7 +1,6 @@
 #include "challenge21.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -58,34 +57,37 @@ namespace {
 using MyCoordinate     = Coordinate<std::int64_t>;
 using Map              = const std::vector<std::string_view>&;
 
-std::int64_t MaxColumn = 0;
-std::int64_t MaxRow    = 0;
-
-bool isValid(const MyCoordinate& coordinate) noexcept {
-    return coordinate.Column >= 0 && coordinate.Column < MaxColumn && coordinate.Row >= 0 && coordinate.Row < MaxRow;
-}
-
 MyCoordinate findStart(Map map) noexcept {
+    const auto   maxRow = static_cast<std::int64_t>(map.size());
     MyCoordinate ret;
-    for ( ret.Row = 0; ret.Row < MaxRow; ++ret.Row ) {
+    for ( ret.Row = 0; ret.Row < maxRow; ++ret.Row ) {
         ret.Column = static_cast<std::int64_t>(map[static_cast<std::size_t>(ret.Row)].find('S'));
 
         if ( static_cast<std::size_t>(ret.Column) != std::string::npos ) {
             return ret;
         } //if ( static_cast<std::size_t>(ret.Column) != std::string::npos )
-    } //for ( ret.Row = 0; ret.Row < MaxRow; ++ret.Row )
+    } //for ( ret.Row = 0; ret.Row < maxRow; ++ret.Row )
     return {};
 }
 
 template<bool Infinite>
 struct ReachableCalculator {
-    ::Map Map;
+    ::Map        Map;
+    std::int64_t MaxRow;
+    std::int64_t MaxColumn;
 
-    ReachableCalculator(::Map map) noexcept : Map{map} {
+    ReachableCalculator(::Map map) noexcept :
+            Map{map}, MaxRow{static_cast<std::int64_t>(map.size())},
+            MaxColumn{static_cast<std::int64_t>(map.front().size())} {
         return;
     }
 
-    std::int64_t calcReachable(MyCoordinate start, std::int64_t totalSteps) noexcept {
+    bool isValid(const MyCoordinate& coordinate) const noexcept {
+        return coordinate.Column >= 0 && coordinate.Column < MaxColumn && coordinate.Row >= 0 &&
+               coordinate.Row < MaxRow;
+    }
+
+    std::int64_t calcReachable(MyCoordinate start, std::int64_t totalSteps) {
         std::unordered_set<MyCoordinate> alreadySeen;
         std::array<std::int64_t, 2>      counter{};
 
@@ -98,7 +100,7 @@ struct ReachableCalculator {
             next.clear();
 
             for ( auto coordinate : current ) {
-                const auto normalizedCoordinate = [](MyCoordinate c) noexcept {
+                const auto normalizedCoordinate = [this](MyCoordinate c) noexcept {
                     if constexpr ( !Infinite ) {
                         return c;
                     } //if constexpr ( !Infinite )
@@ -146,38 +148,49 @@ struct ReachableCalculator {
         return counter[static_cast<std::size_t>(totalSteps) % 2];
     }
 };
-} //namespace
 
-bool challenge21(Map map) {
+struct Garden {
+    std::vector<std::string_view> Plots;
+    MyCoordinate                  Start;
+};
+
+Garden parse(Map map) {
     throwIfInvalid(!map.empty());
 
-    MaxRow           = static_cast<std::int64_t>(map.size());
-    MaxColumn        = static_cast<std::int64_t>(map.front().size());
-    const auto start = findStart(map);
-    throwIfInvalid(MaxColumn == MaxRow);
-    throwIfInvalid(start.Row == MaxRow / 2);
-    throwIfInvalid(start.Column == MaxColumn / 2);
-
-    ReachableCalculator<false> partOneCalculator{map};
-    auto                       reachable = partOneCalculator.calcReachable(start, 64);
-    myPrint(" == Result of Part 1: {:d} ==\n", reachable);
-
-    ReachableCalculator<true> partTwoCalculator{map};
-    auto                      calcPart2 = [&partTwoCalculator, &start](int steps) noexcept {
-        //Extrapolation über ein quadratisches Polynom. Nicht das ich selbst auf die Idee gekommen wäre...
-        auto y1     = partTwoCalculator.calcReachable(start, start.Row);
-        auto y2     = partTwoCalculator.calcReachable(start, MaxRow + start.Row);
-        auto y3     = partTwoCalculator.calcReachable(start, MaxRow * 2 + start.Row);
-
-        auto a      = (y3 + y1 - 2 * y2) / 2;
-        auto b      = (4 * y2 - 3 * y1 - y3) / 2;
-        auto c      = y1;
-        auto evalAt = (steps - start.Row) / MaxRow;
-        auto ret    = (a * evalAt * evalAt) + (b * evalAt) + c;
-        return ret;
-    };
-    auto reachable2 = calcPart2(26501365);
-    myPrint(" == Result of Part 2: {:d} ==\n", reachable2);
-
-    return reachable == 3858 && reachable2 == 636'350'496'972'143;
+    const auto maxRow    = static_cast<std::int64_t>(map.size());
+    const auto maxColumn = static_cast<std::int64_t>(map.front().size());
+    const auto start     = findStart(map);
+    throwIfInvalid(maxColumn == maxRow);
+    throwIfInvalid(start.Row == maxRow / 2);
+    throwIfInvalid(start.Column == maxColumn / 2);
+    return {map, start};
+}
+
+std::int64_t part1(const Garden& garden) {
+    ReachableCalculator<false> calculator{garden.Plots};
+    return calculator.calcReachable(garden.Start, 64);
+}
+
+std::int64_t part2(const Garden& garden) {
+    ReachableCalculator<true> calculator{garden.Plots};
+    const auto&               start  = garden.Start;
+    const auto                maxRow = calculator.MaxRow;
+    const auto                steps  = 26501365;
+
+    //Extrapolation über ein quadratisches Polynom. Nicht das ich selbst auf die Idee gekommen wäre...
+    auto y1     = calculator.calcReachable(start, start.Row);
+    auto y2     = calculator.calcReachable(start, maxRow + start.Row);
+    auto y3     = calculator.calcReachable(start, maxRow * 2 + start.Row);
+
+    auto a      = (y3 + y1 - 2 * y2) / 2;
+    auto b      = (4 * y2 - 3 * y1 - y3) / 2;
+    auto c      = y1;
+    auto evalAt = (steps - start.Row) / maxRow;
+    return (a * evalAt * evalAt) + (b * evalAt) + c;
+}
+} //namespace
+
+const Challenge& challenge21(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(21, 3858, 636'350'496'972'143);
+    return challenge;
 }
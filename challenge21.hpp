@@ -1,9 +1,8 @@
 #ifndef CHALLENGE21_HPP
 #define CHALLENGE21_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge21(const std::vector<std::string_view>& input);
+const Challenge& challenge21(void) noexcept;
 
 #endif //CHALLENGE21_HPP
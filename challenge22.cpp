@@ -2,7 +2,6 @@
 
 #include "coordinate3d.hpp"
 #include "helper.hpp"
-#include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
@@ -201,24 +200,20 @@ Tower parse(const std::vector<std::string_view>& input) {
             } //for ( auto [x, y] : brickPosRange(brick) )
         } //for ( std::int16_t z = brick.Start.Z, k = 0; k < brick.Height; ++k, ++z )
     } //for ( auto line : input )
+    ret.brickFall();
     return ret;
 }
-} //namespace
-
-bool challenge22(const std::vector<std::string_view>& input) {
-    auto tower = parse(input);
-    tower.brickFall();
-
-    auto isBrickDisintegrateable = [&tower](const Brick& brick) noexcept {
-        return tower.isBrickDisintegrateable(brick);
-    };
 
-    auto disintegrateable = std::ranges::count_if(tower.Bricks, isBrickDisintegrateable, &BrickMap::value_type::second);
-    myPrint(" == Result of Part 1: {:d} ==\n", disintegrateable);
+std::int64_t part1(const Tower& tower) noexcept {
+    return std::ranges::count_if(
+        tower.Bricks, [&tower](const Brick& brick) noexcept { return tower.isBrickDisintegrateable(brick); },
+        &BrickMap::value_type::second);
+}
 
+std::int64_t part2(const Tower& tower) {
     auto nonSingleDisintegratable =
-        tower.Bricks | std::views::filter([isBrickDisintegrateable](const BrickMap::value_type& idAndBrick) noexcept {
-            return !isBrickDisintegrateable(idAndBrick.second);
+        tower.Bricks | std::views::filter([&tower](const BrickMap::value_type& idAndBrick) noexcept {
+            return !tower.isBrickDisintegrateable(idAndBrick.second);
         }) |
         std::views::transform(&BrickMap::value_type::first);
 
@@ -228,9 +223,12 @@ bool challenge22(const std::vector<std::string_view>& input) {
         return newTower.brickFall();
     };
 
-    auto sumDisintegrateable =
-        std::ranges::fold_left(nonSingleDisintegratable | std::views::transform(chainDisintegration), 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sumDisintegrateable);
+    return std::ranges::fold_left(nonSingleDisintegratable | std::views::transform(chainDisintegration), 0,
+                                  std::plus<>{});
+}
+} //namespace
 
-    return disintegrateable == 490 && sumDisintegrateable == 96356;
+const Challenge& challenge22(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(22, 490, 96356);
+    return challenge;
 }
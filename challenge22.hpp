@@ -1,9 +1,8 @@
 #ifndef CHALLENGE22_HPP
 #define CHALLENGE22_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge22(const std::vector<std::string_view>& input);
+const Challenge& challenge22(void) noexcept;
 
 #endif //CHALLENGE22_HPP
@@ -1,9 +1,10 @@
 #include "challenge23.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <ranges>
 #include <unordered_map>
@@ -140,6 +141,13 @@ struct Graph {
         const auto firstLine = input.front();
         const auto lastLine  = input.back();
 
+        //Ein geschlossener Rand, in dem nur Start und Ziel offen sind, dann bleibt jeder Weg in der Karte.
+        throwIfInvalid(MaxColumn > 2 && std::ranges::all_of(input, [this](std::string_view line) noexcept {
+                           return line.size() == MaxColumn && line.front() == '#' && line.back() == '#';
+                       }));
+        throwIfInvalid(std::ranges::count(firstLine, '#') == std::ranges::ssize(firstLine) - 1);
+        throwIfInvalid(std::ranges::count(lastLine, '#') == std::ranges::ssize(lastLine) - 1);
+
         const Coordinate startCoordinate{0, firstLine.find('.')};
         const Coordinate targetCoordinate{MaxRow - 1, lastLine.find('.')};
         throwIfInvalid(startCoordinate.Column != std::string_view::npos);
@@ -153,14 +161,14 @@ struct Graph {
     }
 
     template<bool PartOne>
-    std::int32_t calculateLongestPath(void) noexcept {
-        std::vector<Crossing*> visited;
+    std::int32_t calculateLongestPath(void) const {
+        std::vector<const Crossing*> visited;
         return calculateLongestPath<PartOne>(TargetPathway->Begin, TargetPathway, visited);
     }
 
     template<bool PartOne>
-    std::int32_t calculateLongestPath(Crossing* currentCrossing, Pathway* incomingPathway,
-                                      std::vector<Crossing*>& visited) noexcept {
+    std::int32_t calculateLongestPath(const Crossing* currentCrossing, const Pathway* incomingPathway,
+                                      std::vector<const Crossing*>& visited) const {
         auto iter = std::ranges::lower_bound(visited, currentCrossing);
         visited.insert(iter, currentCrossing);
         const auto blockedDirection = directionOfPathway(incomingPathway, currentCrossing);
@@ -184,7 +192,7 @@ struct Graph {
                 continue;
             } //if ( !pathway )
 
-            Crossing* nextCrossing = isUpOrLeft(direction) ? pathway->Begin : pathway->End;
+            const Crossing* nextCrossing = isUpOrLeft(direction) ? pathway->Begin : pathway->End;
             if ( !nextCrossing ) {
                 max = pathway->Length;
                 break;
@@ -197,14 +205,14 @@ struct Graph {
             max = std::max(max, calculateLongestPath<PartOne>(nextCrossing, pathway, visited));
         } //for ( auto direction : directionRangeWithout(blockedDirection) | std::views::filter(filter) )
         iter = std::ranges::lower_bound(visited, currentCrossing);
-        throwIfInvalid(*iter == currentCrossing);
+        checkInvariant(*iter == currentCrossing);
         visited.erase(iter);
         return max + 1 + incomingPathway->Length;
     }
 
     private:
-    bool isValid(Coordinate c) const noexcept {
-        return c.Row < MaxRow && c.Column < MaxColumn;
+    bool isInner(Coordinate c) const noexcept {
+        return c.Row > 0 && c.Row < MaxRow - 1 && c.Column > 0 && c.Column < MaxColumn - 1;
     }
 
     template<bool AssignStart>
@@ -231,11 +239,16 @@ struct Graph {
         PathwayMap.emplace(pathwayStart, pathway);
 
         do { //while ( field == '.' )
-            Direction neighborDirection = *(directionRangeWithout(blockedDirection) |
-                                            std::views::drop_while([&input, &pathwayStart](Direction d) noexcept {
-                                                auto p = pathwayStart.moved(d);
-                                                return input[p.Row][p.Column] == '#';
-                                            })).begin();
+            auto neighbors = directionRangeWithout(blockedDirection) |
+                             std::views::filter([&input, &pathwayStart](Direction d) noexcept {
+                                 auto p = pathwayStart.moved(d);
+                                 return input[p.Row][p.Column] != '#';
+                             });
+            auto neighbor  = neighbors.begin();
+            //Abseits der Kreuzungen geht ein Weg genau in eine Richtung weiter, sonst ist er eine Sackgasse oder
+            //verzweigt ohne Rutschen.
+            throwIfInvalid(neighbor != neighbors.end() && std::next(neighbor) == neighbors.end());
+            const Direction neighborDirection = *neighbor;
             ++pathway->Length;
             pathwayStart.move(neighborDirection);
             blockedDirection = turnAround(neighborDirection);
@@ -256,8 +269,11 @@ struct Graph {
                     toCrossing = turnAround(toCrossing);
                 } //if ( !topDown )
                 PathwayMap.emplace(pathwayStart, pathway);
+                const auto crossingCoordinate = pathwayStart.moved(toCrossing);
+                throwIfInvalid(isInner(crossingCoordinate) &&
+                               input[crossingCoordinate.Row][crossingCoordinate.Column] != '#');
                 (topDown ? pathway->End : pathway->Begin) =
-                    buildCrossing(input, pathwayStart.moved(toCrossing), toCrossing, pathway, targetCoordinate);
+                    buildCrossing(input, crossingCoordinate, toCrossing, pathway, targetCoordinate);
                 break;
             } //case '>' & 'v'
             default : throwIfInvalid(false);
@@ -291,21 +307,26 @@ struct Graph {
         } //switch ( field )
     }
 
-    static Direction directionOfPathway(Pathway* pathway, Crossing* crossing) noexcept {
+    static Direction directionOfPathway(const Pathway* pathway, const Crossing* crossing) noexcept {
         return static_cast<Direction>(
             std::ranges::distance(crossing->Pathways.begin(), std::ranges::find(crossing->Pathways, pathway)));
     }
 };
-} //namespace
 
-bool challenge23(const std::vector<std::string_view>& input) {
-    Graph graph{input};
+Graph parse(const std::vector<std::string_view>& input) {
+    return Graph{input};
+}
 
-    auto maxDirectedPathLength = graph.calculateLongestPath<true>();
-    myPrint(" == Result of Part 1: {:d} ==\n", maxDirectedPathLength);
+std::int64_t part1(const Graph& graph) {
+    return graph.calculateLongestPath<true>();
+}
 
-    auto maxUndirectedPathLength = graph.calculateLongestPath<false>();
-    myPrint(" == Result of Part 2: {:d} ==\n", maxUndirectedPathLength);
+std::int64_t part2(const Graph& graph) {
+    return graph.calculateLongestPath<false>();
+}
+} //namespace
 
-    return maxDirectedPathLength == 2106 && maxUndirectedPathLength == 6350;
+const Challenge& challenge23(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(23, 2106, 6350);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE23_HPP
 #define CHALLENGE23_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge23(const std::vector<std::string_view>& input);
+const Challenge& challenge23(void) noexcept;
 
 #endif //CHALLENGE23_HPP
@@ -2,7 +2,6 @@
 
 #include "coordinate3d.hpp"
 #include "helper.hpp"
-#include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <boost/integer/common_factor_rt.hpp>
@@ -158,7 +157,7 @@ struct Fraction {
     T toBase(void) const {
         Fraction copy{*this};
         copy.normalize();
-        throwIfInvalid(copy.Denominator == 1);
+        throwIfInvalid(copy.Denominator == 1, "Non integer position");
         return copy.Numerator;
     }
 
@@ -237,7 +236,7 @@ struct Equation {
             case 5 : return Z;
             case 6 : return B;
         } //switch ( index )
-        throwIfInvalid(false);
+        checkInvariant(false);
         return B;
     }
 
@@ -251,7 +250,7 @@ struct Equation {
             case 5 : return Z;
             case 6 : return B;
         } //switch ( index )
-        throwIfInvalid(false);
+        checkInvariant(false);
         return B;
     }
 
@@ -423,19 +422,20 @@ Coordinate3D<std::int64_t> calcRockThrowPosition(const std::vector<HailStoneTraj
 
     return system.getPosition();
 }
-} //namespace
 
-bool challenge24(const std::vector<std::string_view>& input) {
-    const auto                trajectories = parse(input);
+std::int64_t part1(const std::vector<HailStoneTrajectory>& trajectories) {
     std::vector<TwoDFunction> functions(trajectories.size());
     std::ranges::transform(trajectories, functions.begin(), toFunction);
+    return calcCollidingPaths(functions, 200'000'000'000'000., 400'000'000'000'000.);
+}
 
-    auto collidingHailStonePaths = calcCollidingPaths(functions, 200'000'000'000'000., 400'000'000'000'000.);
-    myPrint(" == Result of Part 1: {:d} ==\n", collidingHailStonePaths);
-
+std::int64_t part2(const std::vector<HailStoneTrajectory>& trajectories) {
     auto rockThrowPosition = calcRockThrowPosition(trajectories);
-    auto rockThrowSum      = rockThrowPosition.X + rockThrowPosition.Y + rockThrowPosition.Z;
-    myPrint(" == Result of Part 2: {:d} ==\n", rockThrowSum);
+    return rockThrowPosition.X + rockThrowPosition.Y + rockThrowPosition.Z;
+}
+} //namespace
 
-    return collidingHailStonePaths == 20336 && rockThrowSum == 677'656'046'662'770;
+const Challenge& challenge24(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(24, 20336, 677'656'046'662'770);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE24_HPP
 #define CHALLENGE24_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge24(const std::vector<std::string_view>& input);
+const Challenge& challenge24(void) noexcept;
 
 #endif //CHALLENGE24_HPP
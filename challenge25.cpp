@@ -1,7 +1,6 @@
 #include "challenge25.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <map>
@@ -105,14 +104,14 @@ std::pair<std::vector<Node*>, std::vector<Node*>> calculateCut(const Graph& grap
 
     return ret;
 }
-} //namespace
-
-bool challenge25(const std::vector<std::string_view>& input) {
-    const auto graph      = parse(input);
 
+std::int64_t part1(const Graph& graph) {
     auto [group1, group2] = calculateCut(graph, 3);
-    auto groupSizeProduct = group1.size() * group2.size();
-    myPrint(" == Result of Part 1: {:d} ==\n", groupSizeProduct);
+    return static_cast<std::int64_t>(group1.size() * group2.size());
+}
+} //namespace
 
-    return groupSizeProduct == 612945;
+const Challenge& challenge25(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1>(25, 612945);
+    return challenge;
 }
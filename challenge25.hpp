@@ -1,9 +1,8 @@
 #ifndef CHALLENGE25_HPP
 #define CHALLENGE25_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge25(const std::vector<std::string_view>& input);
+const Challenge& challenge25(void) noexcept;
 
 #endif //CHALLENGE25_HPP
@@ -1,7 +1,6 @@
 #include "challenge3.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -192,12 +191,18 @@ struct hash<Pos> {
 };
 } //namespace std
 
-bool challenge3(const std::vector<std::string_view> &input) {
-    std::vector<Pos>             symbolPositions;
-    std::vector<Pos>             gearPositions;
-    std::unordered_map<Pos, int> numbers;
-    std::unordered_map<Pos, Pos> additionalNumberPositions;
-    std::size_t                  maxColumn = 0;
+namespace {
+struct Schematic {
+    std::vector<Pos>             SymbolPositions;
+    std::vector<Pos>             GearPositions;
+    std::unordered_map<Pos, int> Numbers;
+    std::unordered_map<Pos, Pos> AdditionalNumberPositions;
+    Pos                          MaxDimensions;
+};
+
+Schematic parse(const std::vector<std::string_view>& input) {
+    Schematic   ret;
+    std::size_t maxColumn = 0;
 
     for ( std::size_t row = 0; row < input.size(); ++row ) {
         const auto& rowText = input[row];
@@ -207,16 +212,16 @@ bool challenge3(const std::vector<std::string_view> &input) {
         while ( pos != std::string_view::npos ) {
             if ( std::isdigit(static_cast<unsigned char>(rowText[pos])) ) {
                 auto [number, endOfNumber] = extractNumber(rowText, pos);
-                numbers.emplace(Pos{row, pos}, number);
+                ret.Numbers.emplace(Pos{row, pos}, number);
                 for ( auto numberLength = endOfNumber - pos; numberLength > 1; --numberLength ) {
-                    additionalNumberPositions.emplace(Pos{row, pos + numberLength - 1}, Pos{row, pos});
+                    ret.AdditionalNumberPositions.emplace(Pos{row, pos + numberLength - 1}, Pos{row, pos});
                 } //for ( auto numberLength = endOfNumber - pos; numberLength > 1; --numberLength )
                 pos = endOfNumber;
             } //if ( std::isdigit(static_cast<unsigned char>(rowText[pos])) )
             else {
-                symbolPositions.push_back({row, pos});
+                ret.SymbolPositions.push_back({row, pos});
                 if ( rowText[pos] == '*' ) {
-                    gearPositions.push_back({row, pos});
+                    ret.GearPositions.push_back({row, pos});
                 } //if ( rowText[pos] == '*' )
                 ++pos;
             } //else -> if ( std::isdigit(static_cast<unsigned char>(rowText[pos])) )
@@ -224,13 +229,41 @@ bool challenge3(const std::vector<std::string_view> &input) {
         } //while ( pos != std::string_view::npos )
     } //for ( std::size_t row = 0; row < input.size(); ++row )
 
-    const Pos maxDimensions{input.size(), maxColumn};
+    ret.MaxDimensions = {input.size(), maxColumn};
+    return ret;
+}
+
+std::int64_t part1(const Schematic& schematic) {
+    auto numbers                   = schematic.Numbers;
+    auto additionalNumberPositions = schematic.AdditionalNumberPositions;
+
+    AdjacentSymbolPositions adjacentSymbolPositions{schematic.SymbolPositions, schematic.MaxDimensions};
+
+    int sum1 = 0;
+    for ( auto position : adjacentSymbolPositions ) {
+        if ( auto mappingIter = additionalNumberPositions.find(position);
+             mappingIter != additionalNumberPositions.end() ) {
+            position = mappingIter->second;
+            additionalNumberPositions.erase(mappingIter);
+        } //if ( additionalNumberPositions.find(position) != additionalNumberPositions.end() )
+
+        if ( auto iter = numbers.find(position); iter != numbers.end() ) {
+            sum1 += iter->second;
+            numbers.erase(iter);
+        } //if ( auto iter = numbers.find(position); iter != Numbers.end() )
+    } //for ( auto position : adjacentSymbolPositions )
+    return sum1;
+}
+
+std::int64_t part2(const Schematic& schematic) {
+    const auto& gearPositions             = schematic.GearPositions;
+    const auto& additionalNumberPositions = schematic.AdditionalNumberPositions;
 
-    int  sum2        = 0;
-    auto gearNumbers = numbers;
+    int  sum2                             = 0;
+    auto gearNumbers                      = schematic.Numbers;
 
     for ( auto gear = gearPositions.begin(); gear != gearPositions.end(); ++gear ) {
-        AdjacentSymbolPositions positionsForThatGear{gear, std::next(gear), maxDimensions};
+        AdjacentSymbolPositions positionsForThatGear{gear, std::next(gear), schematic.MaxDimensions};
         int                     counter = 0;
         int                     power   = 1;
 
@@ -253,25 +286,11 @@ bool challenge3(const std::vector<std::string_view> &input) {
             sum2 += power;
         } //if ( counter == 2 )
     } //for ( auto gear = gearPositions.begin(); gear != gearPositions.end(); ++gear )
+    return sum2;
+}
+} //namespace
 
-    AdjacentSymbolPositions adjacentSymbolPositions{symbolPositions, maxDimensions};
-
-    int sum1 = 0;
-    for ( auto position : adjacentSymbolPositions ) {
-        if ( auto mappingIter = additionalNumberPositions.find(position);
-             mappingIter != additionalNumberPositions.end() ) {
-            position = mappingIter->second;
-            additionalNumberPositions.erase(mappingIter);
-        } //if ( additionalNumberPositions.find(position) != additionalNumberPositions.end() )
-
-        if ( auto iter = numbers.find(position); iter != numbers.end() ) {
-            sum1 += iter->second;
-            numbers.erase(iter);
-        } //if ( auto iter = numbers.find(position); iter != Numbers.end() )
-    } //for ( auto position : adjacentSymbolPositions )
-
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-
-    return sum1 == 557705 && sum2 == 84266818;
+const Challenge& challenge3(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(3, 557705, 84266818);
+    return challenge;
 }
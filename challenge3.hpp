@@ -1,9 +1,8 @@
 #ifndef CHALLENGE3_HPP
 #define CHALLENGE3_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge3(const std::vector<std::string_view>& input);
+const Challenge& challenge3(void) noexcept;
 
 #endif //CHALLENGE3_HPP
@@ -1,23 +1,20 @@
 #include "challenge4.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <cstring>
-#include <iostream>
 #include <ranges>
+#include <span>
 #include <string_view>
 
 using namespace std::string_view_literals;
 
 namespace {
 struct Card {
-    std::int64_t              Number = 0;
-    std::vector<std::int64_t> WinninNumbers;
-    std::vector<std::int64_t> Numbers;
-    std::int64_t              Matching = 0;
-    std::int64_t              Points   = 0;
+    std::int64_t Number   = 0;
+    std::int64_t Matching = 0;
+    std::int64_t Points   = 0;
 };
 
 struct CountingIterator {
@@ -40,70 +37,42 @@ struct CountingIterator {
     }
 };
 
+std::int64_t countMatching(std::span<const std::int64_t> winningNumbers, std::span<const std::int64_t> numbers,
+                           std::vector<std::int64_t>& sortedWinning, std::vector<std::int64_t>& sortedNumbers) {
+    sortedWinning.assign(winningNumbers.begin(), winningNumbers.end());
+    sortedNumbers.assign(numbers.begin(), numbers.end());
+    std::ranges::sort(sortedWinning);
+    std::ranges::sort(sortedNumbers);
+    return std::ranges::set_intersection(sortedWinning, sortedNumbers, CountingIterator{}).out.Count;
+}
+
 std::vector<Card> parse(const std::vector<std::string_view>& input) {
-    enum class State { Card, Number, Winning, Numbers } state = State::Card;
-    std::vector<Card> ret;
-    Card*             currentCard;
-
-    for ( auto line : input ) {
-        for ( const auto& word : splitString(line, ' ') ) {
-            switch ( state ) {
-                case State::Number : {
-                    currentCard->Number = convert(word);
-                    state               = State::Winning;
-                    break;
-                } //case State::Number
-
-                case State::Winning : {
-                    if ( word == "|"sv ) {
-                        state = State::Numbers;
-                        break;
-                    } //if ( word == "|"sv )
-
-                    currentCard->WinninNumbers.push_back(convert(word));
-                    break;
-                } //case State::Winning
-
-                case State::Numbers : {
-                    if ( word != "Card"sv ) {
-                        currentCard->Numbers.push_back(convert(word));
-                        break;
-                    } //if ( word != "Card"sv )
-                    [[fallthrough]];
-                } //case State::Numbers
-
-                case State::Card : {
-                    throwIfInvalid(word == "Card"sv);
-                    currentCard = &ret.emplace_back();
-                    state       = State::Number;
-                    break;
-                } //case State::Card
-            } //switch ( state )
-        } //for ( const auto& word : splitString(line, ' ') )
-    } //for ( auto line : input )
+    //Pro Karte drei Zeilen: Die Nummer, die Gewinnzahlen und die eigenen Zahlen.
+    const IntegerTable table{input, ":|"sv};
+    throwIfInvalid(table.rowCount() == 3 * input.size());
+
+    std::vector<Card>         ret;
+    std::vector<std::int64_t> sortedWinning;
+    std::vector<std::int64_t> sortedNumbers;
+    ret.reserve(input.size());
+
+    for ( std::size_t i = 0; i < input.size(); ++i ) {
+        const auto number = table.row(3 * i);
+        throwIfInvalid(input[i].starts_with("Card"sv) && number.size() == 1);
+
+        auto& card    = ret.emplace_back();
+        card.Number   = number[0];
+        card.Matching = countMatching(table.row(3 * i + 1), table.row(3 * i + 2), sortedWinning, sortedNumbers);
+        card.Points   = card.Matching == 0 ? 0 : 1 << (card.Matching - 1);
+    } //for ( std::size_t i = 0; i < input.size(); ++i )
     return ret;
 }
 
-void sortAndCalcPoints(Card& card) noexcept {
-    std::ranges::sort(card.WinninNumbers);
-    std::ranges::sort(card.Numbers);
-
-    card.Matching = std::ranges::set_intersection(card.WinninNumbers, card.Numbers, CountingIterator{}).out.Count;
-    card.Points   = card.Matching == 0 ? 0 : 1 << (card.Matching - 1);
-
-    return;
+std::int64_t part1(const std::vector<Card>& cards) noexcept {
+    return std::ranges::fold_left(cards | std::views::transform(&Card::Points), 0, std::plus<>{});
 }
-} //namespace
-
-bool challenge4(const std::vector<std::string_view>& input) {
-    std::cout << " == Starting Challenge 4 ==\n";
-
-    std::vector<Card> cards = parse(input);
-    std::ranges::for_each(cards, sortAndCalcPoints);
-
-    const auto sum1 = std::ranges::fold_left(cards | std::views::transform(&Card::Points), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
 
+std::int64_t part2(const std::vector<Card>& cards) {
     std::vector<int> totalCards;
     totalCards.resize(cards.size());
 
@@ -118,8 +87,11 @@ bool challenge4(const std::vector<std::string_view>& input) {
         } //for ( std::size_t j = i + 1, addEnd = std::min(end, i + 1 + cardsToAdd); j < addEnd; ++j )
     } //for ( std::size_t i = 0, end = cards.size(); i < end; ++i )
 
-    const auto sum2 = std::ranges::fold_left(totalCards, 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+    return std::ranges::fold_left(totalCards, 0, std::plus<>{});
+}
+} //namespace
 
-    return sum1 == 21568 && sum2 == 11827296;
+const Challenge& challenge4(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(4, 21568, 11827296);
+    return challenge;
 }
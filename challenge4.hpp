@@ -1,9 +1,8 @@
 #ifndef CHALLENGE4_HPP
 #define CHALLENGE4_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge4(const std::vector<std::string_view>& input);
+const Challenge& challenge4(void) noexcept;
 
 #endif //CHALLENGE4_HPP
@@ -1,10 +1,9 @@
 #include "challenge5.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
-#include <future>
+#include <limits>
 #include <ranges>
 #include <string_view>
 
@@ -17,114 +16,171 @@ struct Map {
     std::int64_t Length;
 };
 
+/**
+ * @brief Ab Begin (Seed) wird Offset addiert, bis zum nächsten Breakpoint.
+ */
+struct Breakpoint {
+    std::int64_t Begin;
+    std::int64_t Offset;
+};
+
 struct SeedMap {
     std::vector<std::int64_t>     Seeds;
     std::vector<std::vector<Map>> Maps;
+    //! Alle Schichten zusammen als eine stückweise lineare Funktion, sortiert nach Begin.
+    std::vector<Breakpoint>       Composed;
 };
 
-SeedMap parse(const std::vector<std::string_view>& input) {
-    enum class State { Seeds, Seed, Map, DestinationStart, SourceStart, Length } state = State::Seeds;
-    SeedMap           ret;
-    std::vector<Map>* currentMaps = nullptr;
-    Map*              currentMap;
-
-    for ( auto line : input ) {
-        for ( const auto& word : splitString(line, ' ') ) {
-            switch ( state ) {
-                case State::Seeds : {
-                    throwIfInvalid(word == "seeds:"sv);
-                    state = State::Seed;
-                    break;
-                } //case State::Seeds
-
-                case State::Seed : {
-                    auto number = convertOptionally(word);
-                    if ( !number ) {
-                        state = State::Map;
-                        break;
-                    } //if ( !number )
-
-                    ret.Seeds.push_back(*number);
-                    break;
-                } //case State::Seed
-
-                case State::Map : {
-                    throwIfInvalid(word == "map:"sv);
-                    currentMaps = &ret.Maps.emplace_back();
-                    state       = State::DestinationStart;
-                    break;
-                } //case State::Map
-
-                case State::DestinationStart : {
-                    auto number = convertOptionally(word);
-                    if ( !number ) {
-                        state = State::Map;
-                        break;
-                    } //if ( !number )
-                    currentMap              = &currentMaps->emplace_back();
-                    currentMap->Destination = *number;
-                    state                   = State::SourceStart;
-                    break;
-                } //case State::DesinationStart
-
-                case State::SourceStart : {
-                    auto number = convertOptionally(word);
-                    throwIfInvalid(number.has_value());
-                    currentMap->Source = *number;
-                    state              = State::Length;
-                    break;
-                } //case State::SourceStart
-
-                case State::Length : {
-                    auto number = convertOptionally(word);
-                    throwIfInvalid(number.has_value());
-                    currentMap->Length = *number;
-                    state              = State::DestinationStart;
-                    break;
-                } //case State::Length
-            } //switch ( state )
-        } //for ( const auto& word : splitString(line, ' ') )
-    } //for ( auto line : input )
+/**
+ * @brief Ein Bereich von Seeds (oder was daraus geworden ist), End gehört nicht mehr dazu.
+ */
+struct Interval {
+    std::int64_t Begin;
+    std::int64_t End;
+};
+
+/**
+ * @brief Schiebt die Intervalle durch eine Schicht, sie werden dabei an den Grenzen der Maps aufgeteilt.
+ */
+void applyMaps(const std::vector<Map>& maps, const std::vector<Interval>& intervals, std::vector<Interval>& result) {
+    result.clear();
+    for ( auto [begin, end] : intervals ) {
+        //Die erste Map, die nicht komplett vor dem Intervall liegt.
+        auto map = std::ranges::partition_point(maps, [begin](const Map& candidate) noexcept {
+            return candidate.Source + candidate.Length <= begin;
+        });
+
+        for ( ; map != maps.end() && map->Source < end && begin < end; ++map ) {
+            if ( begin < map->Source ) {
+                result.push_back({begin, map->Source});
+                begin = map->Source;
+            } //if ( begin < map->Source )
+
+            const auto mappedEnd = std::min(end, map->Source + map->Length);
+            const auto offset    = map->Destination - map->Source;
+            if ( begin < mappedEnd ) {
+                result.push_back({begin + offset, mappedEnd + offset});
+                begin = mappedEnd;
+            } //if ( begin < mappedEnd )
+        } //for ( ; map != maps.end() && map->Source < end && begin < end; ++map )
+
+        if ( begin < end ) {
+            result.push_back({begin, end});
+        } //if ( begin < end )
+    } //for ( auto [begin, end] : intervals )
+    return;
+}
 
+/**
+ * @brief Setzt die (sortierten) Schichten zu einer Funktion zusammen. Das Ergebnis deckt alle sinnvollen Seeds ab.
+ */
+std::vector<Breakpoint> compose(const std::vector<std::vector<Map>>& layers) {
+    //Mit Abstand zu den Grenzen von int64, damit die Offsets nicht überlaufen.
+    constexpr std::int64_t domainBegin = std::numeric_limits<std::int64_t>::min() / 2;
+    constexpr std::int64_t domainEnd   = std::numeric_limits<std::int64_t>::max() / 2;
+
+    std::vector<Breakpoint> ret{{domainBegin, 0}};
+    std::vector<Breakpoint> next;
+    std::vector<Interval>   pieces;
+
+    for ( const auto& maps : layers ) {
+        next.clear();
+        for ( std::size_t i = 0; i < ret.size(); ++i ) {
+            const auto [begin, offset] = ret[i];
+            const auto end             = i + 1 < ret.size() ? ret[i + 1].Begin : domainEnd;
+            applyMaps(maps, {{begin + offset, end + offset}}, pieces);
+
+            //Die Teile kommen in der Reihenfolge der Quelle und lückenlos, daraus ergibt sich ihr Anfang.
+            auto source = begin;
+            for ( const auto& piece : pieces ) {
+                const auto pieceOffset = piece.Begin - source;
+                if ( next.empty() || next.back().Offset != pieceOffset ) {
+                    next.push_back({source, pieceOffset});
+                } //if ( next.empty() || next.back().Offset != pieceOffset )
+                source += piece.End - piece.Begin;
+            } //for ( const auto& piece : pieces )
+        } //for ( std::size_t i = 0; i < ret.size(); ++i )
+        std::swap(ret, next);
+    } //for ( const auto& maps : layers )
     return ret;
 }
-} //namespace
 
-bool challenge5(const std::vector<std::string_view>& input) {
-    const auto seedMap = parse(input);
-    auto       work    = seedMap.Seeds;
-
-    auto applyMaps     = [&seedMap](std::int64_t entry) noexcept {
-        for ( const auto& maps : seedMap.Maps ) {
-            for ( const auto& map : maps ) {
-                if ( entry >= map.Source && entry < map.Source + map.Length ) {
-                    entry -= map.Source;
-                    entry += map.Destination;
-                    break;
-                } //if ( entry >= map.Source && entry < map.Source + map.Length )
-            } //for ( const auto& map : maps )
-        } //for ( const auto& maps : seedMap.Maps )
-        return entry;
-    };
-
-    std::ranges::for_each(seedMap.Seeds, applyMaps);
-    auto min1 = std::ranges::min(seedMap.Seeds | std::views::transform(applyMaps));
-    myPrint(" == Result of Part 1: {:d} ==\n", min1);
-
-    work.clear();
-    throwIfInvalid(seedMap.Seeds.size() % 2 == 0);
+/**
+ * @brief Die verzweigungsfreie binäre Suche nach dem letzten Breakpoint mit Begin <= seed.
+ */
+std::int64_t lookup(const std::vector<Breakpoint>& function, std::int64_t seed) noexcept {
+    auto        base  = function.data();
+    std::size_t count = function.size();
+    while ( count > 1 ) {
+        const auto half  = count / 2;
+        base             = base[half].Begin <= seed ? base + half : base;
+        count           -= half;
+    } //while ( count > 1 )
+    return seed + base->Offset;
+}
 
-    std::vector<std::future<std::int64_t>> results;
+SeedMap parse(const std::vector<std::string_view>& input) {
+    throwIfInvalid(!input.empty() && input[0].starts_with("seeds:"sv));
+    const IntegerTable table{input};
+    const auto         seeds = table.row(0);
+    SeedMap            ret{{seeds.begin(), seeds.end()}, {}, {}};
+
+    //Die Überschrift einer Map hat keine Zahlen, danach kommt eine Zeile pro Abbildung.
+    for ( std::size_t i = 1; i < table.rowCount(); ++i ) {
+        const auto row = table.row(i);
+        if ( row.empty() ) {
+            if ( input[i].ends_with("map:"sv) ) {
+                ret.Maps.emplace_back();
+            } //if ( input[i].ends_with("map:"sv) )
+            continue;
+        } //if ( row.empty() )
+
+        throwIfInvalid(row.size() == 3 && !ret.Maps.empty());
+        throwIfInvalid(row[2] > 0, "Empty map");
+        ret.Maps.back().push_back({row[1], row[0], row[2]});
+    } //for ( std::size_t i = 1; i < table.rowCount(); ++i )
+
+    //Sortiert nach Quelle kann man Intervalle in einem Durchgang durch eine Schicht schieben.
+    for ( auto& maps : ret.Maps ) {
+        std::ranges::sort(maps, {}, &Map::Source);
+        const auto overlapping = [](const Map& previous, const Map& next) noexcept {
+            return previous.Source + previous.Length > next.Source;
+        };
+        throwIfInvalid(std::ranges::adjacent_find(maps, overlapping) == maps.end(), "Overlapping maps");
+    } //for ( auto& maps : ret.Maps )
+
+    ret.Composed = compose(ret.Maps);
+    return ret;
+}
 
+std::int64_t part1(const SeedMap& seedMap) noexcept {
+    return std::ranges::min(seedMap.Seeds | std::views::transform([&seedMap](std::int64_t seed) noexcept {
+                                return lookup(seedMap.Composed, seed);
+                            }));
+}
+
+std::int64_t part2(const SeedMap& seedMap) {
+    throwIfInvalid(seedMap.Seeds.size() % 2 == 0);
+
+    std::vector<Interval> intervals;
+    std::vector<Interval> next;
     for ( std::size_t i = 0; i < seedMap.Seeds.size(); i += 2 ) {
-        results.push_back(std::async(std::launch::async, [i, &seedMap, &applyMaps](void) noexcept {
-            return std::ranges::min(std::views::iota(seedMap.Seeds[i]) | std::views::take(seedMap.Seeds[i + 1]) |
-                                    std::views::transform(applyMaps));
-        }));
+        if ( seedMap.Seeds[i + 1] > 0 ) {
+            intervals.push_back({seedMap.Seeds[i], seedMap.Seeds[i] + seedMap.Seeds[i + 1]});
+        } //if ( seedMap.Seeds[i + 1] > 0 )
     } //for ( std::size_t i = 0; i < seedMap.Seeds.size(); i += 2 )
+    throwIfInvalid(!intervals.empty());
+
+    for ( const auto& maps : seedMap.Maps ) {
+        applyMaps(maps, intervals, next);
+        std::swap(intervals, next);
+    } //for ( const auto& maps : seedMap.Maps )
 
-    auto min2 = std::ranges::min(results | std::views::transform([](auto& f) noexcept { return f.get(); }));
-    myPrint(" == Result of Part 1: {:d} ==\n", min2);
+    return std::ranges::min(intervals | std::views::transform(&Interval::Begin));
+}
+} //namespace
 
-    return min1 == 51752125 && min2 == 12634632;
+const Challenge& challenge5(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(5, 51752125, 12634632);
+    return challenge;
 }
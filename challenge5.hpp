@@ -1,9 +1,8 @@
 #ifndef CHALLENGE5_HPP
 #define CHALLENGE5_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge5(const std::vector<std::string_view>& input);
+const Challenge& challenge5(void) noexcept;
 
 #endif //CHALLENGE5_HPP
@@ -1,7 +1,6 @@
 #include "challenge6.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <ranges>
@@ -15,47 +14,34 @@ struct Race {
     std::int64_t Distance;
 };
 
-std::pair<std::vector<Race>, Race> parse(const std::vector<std::string_view>& input) {
-    enum class State { Time, Times, Distances } state = State::Time;
-    std::vector<Race> races;
-    Race*             currentRace;
-    std::string       overallTime;
-    std::string       overallDuration;
-
-    for ( auto line : input ) {
-        for ( const auto& word : splitString(line, ' ') ) {
-            switch ( state ) {
-                case State::Time : {
-                    throwIfInvalid(word == "Time:"sv);
-                    state = State::Times;
-                    break;
-                } //case State::Time
+using ParseResult = std::pair<std::vector<Race>, Race>;
 
-                case State::Times : {
-                    if ( word == "Distance:"sv ) {
-                        throwIfInvalid(!races.empty());
-                        state       = State::Distances;
-                        currentRace = &races[0];
-                        break;
-                    } //if ( word == "Distance:"sv )
+//! Hängt die Ziffern von right an left an, so als wären die Leerzeichen dazwischen nicht da.
+std::int64_t concatenate(std::int64_t left, std::int64_t right) noexcept {
+    std::int64_t shift = 10;
+    while ( shift <= right ) {
+        shift *= 10;
+    } //while ( shift <= right )
+    return left * shift + right;
+}
 
-                    overallTime += word;
-                    races.push_back({convert(word), 0});
-                    break;
-                } //case State::Times
+ParseResult parse(const std::vector<std::string_view>& input) {
+    throwIfInvalid(input.size() >= 2 && input[0].starts_with("Time:"sv) && input[1].starts_with("Distance:"sv));
+    const IntegerTable table{input};
+    const auto         times     = table.row(0);
+    const auto         distances = table.row(1);
+    throwIfInvalid(!times.empty() && times.size() == distances.size());
 
-                case State::Distances : {
-                    throwIfInvalid(currentRace - &races[0] < static_cast<std::int64_t>(races.size()));
-                    overallDuration       += word;
-                    currentRace->Distance  = convert(word);
-                    ++currentRace;
-                    break;
-                } //case State::Distances
-            } //switch ( state )
-        } //for ( const auto& word : splitString(line, ' ') )
-    } //for ( auto line : input )
+    std::vector<Race> races;
+    Race              overall{0, 0};
+    races.reserve(times.size());
+    for ( std::size_t i = 0; i < times.size(); ++i ) {
+        races.push_back({times[i], distances[i]});
+        overall.Time     = concatenate(overall.Time, times[i]);
+        overall.Distance = concatenate(overall.Distance, distances[i]);
+    } //for ( std::size_t i = 0; i < times.size(); ++i )
 
-    return {races, Race{convert(overallTime), convert(overallDuration)}};
+    return {std::move(races), overall};
 }
 
 std::int64_t numberOfWinStrategies(const Race& race) noexcept {
@@ -70,17 +56,17 @@ std::int64_t numberOfWinStrategies(const Race& race) noexcept {
     });
     return ret;
 }
-} //namespace
 
-bool challenge6(const std::vector<std::string_view> &input) {
-    const auto [races, bigRace] = parse(input);
-
-    const auto product =
-        std::ranges::fold_left(races | std::views::transform(numberOfWinStrategies), 1, std::multiplies<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", product);
+std::int64_t part1(const ParseResult& races) noexcept {
+    return std::ranges::fold_left(races.first | std::views::transform(numberOfWinStrategies), 1, std::multiplies<>{});
+}
 
-    const auto wins = numberOfWinStrategies(bigRace);
-    myPrint(" == Result of Part 2: {:d} ==\n", wins);
+std::int64_t part2(const ParseResult& races) noexcept {
+    return numberOfWinStrategies(races.second);
+}
+} //namespace
 
-    return product == 1710720 && wins == 35349468;
+const Challenge& challenge6(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(6, 1710720, 35349468);
+    return challenge;
 }
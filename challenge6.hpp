@@ -1,9 +1,8 @@
 #ifndef CHALLENGE6_HPP
 #define CHALLENGE6_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge6(const std::vector<std::string_view>& input);
+const Challenge& challenge6(void) noexcept;
 
 #endif //CHALLENGE6_HPP
@@ -1,7 +1,6 @@
 #include "challenge7.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <functional>
@@ -150,26 +149,30 @@ std::vector<Hand> parse(const std::vector<std::string_view>& input) {
 
     return hands;
 }
-} //namespace
-
-bool challenge7(const std::vector<std::string_view> &input) {
 
-    auto hands = parse(input);
+std::int64_t totalWinnings(std::vector<Hand>& hands) noexcept {
     std::ranges::sort(hands);
-    const auto sum1 = std::ranges::fold_left(
+    return std::ranges::fold_left(
         hands | std::views::transform([rank = 0](const Hand& hand) mutable noexcept { return ++rank * hand.Bid; }), 0,
         std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+}
+
+std::int64_t part1(const std::vector<Hand>& input) {
+    auto hands = input;
+    return totalWinnings(hands);
+}
 
+std::int64_t part2(const std::vector<Hand>& input) {
+    auto hands = input;
     std::ranges::for_each(hands, [](Hand& hand) noexcept {
         hand.Kind = calculateKind<true>(hand.Cards);
         return;
     });
-    std::ranges::sort(hands);
-    const auto sum2 = std::ranges::fold_left(
-        hands | std::views::transform([rank = 0](const Hand& hand) mutable noexcept { return ++rank * hand.Bid; }), 0,
-        std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+    return totalWinnings(hands);
+}
+} //namespace
 
-    return sum1 == 248'396'258 && sum2 == 246'436'046;
+const Challenge& challenge7(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(7, 248'396'258, 246'436'046);
+    return challenge;
 }
@@ -1,9 +1,8 @@
 #ifndef CHALLENGE7_HPP
 #define CHALLENGE7_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge7(const std::vector<std::string_view>& input);
+const Challenge& challenge7(void) noexcept;
 
 #endif //CHALLENGE7_HPP
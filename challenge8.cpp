@@ -1,7 +1,6 @@
 #include "challenge8.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
@@ -46,6 +45,7 @@ Map parse(const std::vector<std::string_view>& input) {
 
     throwIfInvalid(input.size() >= 1);
     map.Directions = parseDirections(input[0]);
+    throwIfInvalid(!map.Directions.empty());
 
     for ( auto line : input | std::views::drop(1) ) {
         const auto match = ctre::match<"(\\w{3}) = \\((\\w{3}), (\\w{3})\\)">(line);
@@ -59,6 +59,11 @@ Map parse(const std::vector<std::string_view>& input) {
         } //if ( name.ends_with('A') )
     } //for ( auto line : input | std::views::drop(1) )
 
+    //Danach wird beim Laufen ohne Prüfung nachgeschlagen.
+    throwIfInvalid(map.Nodes.contains("AAA"sv));
+    for ( const auto& node : map.Nodes | std::views::values ) {
+        throwIfInvalid(map.Nodes.contains(node.Left) && map.Nodes.contains(node.Right));
+    } //for ( const auto& node : map.Nodes | std::views::values )
     return map;
 }
 
@@ -76,10 +81,9 @@ std::int64_t calcSteps(const Map& map, std::string_view start, F atTarget) {
         return direction;
     };
 
-    const auto next = [nodeEnd = map.Nodes.end(), &map, &nextDirection](std::string_view node) {
-        auto mapNode = map.Nodes.find(node);
-        throwIfInvalid(mapNode != nodeEnd);
-        return *nextDirection == Direction::Left ? mapNode->second.Left : mapNode->second.Right;
+    const auto next = [&map, &nextDirection](std::string_view node) {
+        const auto& mapNode = map.Nodes.find(node)->second;
+        return *nextDirection == Direction::Left ? mapNode.Left : mapNode.Right;
     };
 
     while ( !atTarget(current) ) {
@@ -89,20 +93,22 @@ std::int64_t calcSteps(const Map& map, std::string_view start, F atTarget) {
     } //while ( !atTarget(current) )
     return steps;
 }
-} //namespace
 
-bool challenge8(const std::vector<std::string_view> &input) {
-    const auto map   = parse(input);
-    const auto steps = calcSteps(map, "AAA"sv, [](std::string_view node) noexcept { return node == "ZZZ"sv; });
-    myPrint(" == Result of Part 1: {:d} ==\n", steps);
+std::int64_t part1(const Map& map) {
+    return calcSteps(map, "AAA"sv, [](std::string_view node) noexcept { return node == "ZZZ"sv; });
+}
 
+std::int64_t part2(const Map& map) {
     std::vector<std::int64_t> ghostSteps(map.GhostStarts.size());
     std::ranges::transform(map.GhostStarts, ghostSteps.begin(), [&map](std::string_view start) {
         return calcSteps(map, start, [](std::string_view node) noexcept { return node.ends_with('Z'); });
     });
 
-    const auto ghostStep = std::ranges::fold_left(ghostSteps, 1, std::lcm<std::int64_t, std::int64_t>);
-    myPrint(" == Result of Part 2: {:d} ==\n", ghostStep);
+    return std::ranges::fold_left(ghostSteps, 1, std::lcm<std::int64_t, std::int64_t>);
+}
+} //namespace
 
-    return steps == 12083 && ghostStep == 13'385'272'668'829;
+const Challenge& challenge8(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(8, 12083, 13'385'272'668'829);
+    return challenge;
 }
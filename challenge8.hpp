@@ -1,9 +1,8 @@
 #ifndef CHALLENGE8_HPP
 #define CHALLENGE8_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge8(const std::vector<std::string_view>& input);
+const Challenge& challenge8(void) noexcept;
 
 #endif //CHALLENGE8_HPP
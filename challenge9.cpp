@@ -1,33 +1,25 @@
 #include "challenge9.hpp"
 
 #include "helper.hpp"
-#include "print.hpp"
 
 #include <algorithm>
 #include <functional>
-#include <iterator>
 #include <ranges>
+#include <span>
 
 namespace {
-using Sequence = std::vector<std::int64_t>;
+using Sequence = std::span<const std::int64_t>;
 
-std::vector<Sequence> parse(const std::vector<std::string_view>& input) {
-    std::vector<Sequence> sequences;
-
-    for ( const auto& line : input ) {
-        if ( line.empty() ) {
-            continue;
-        } //if ( line.empty() )
+IntegerTable parse(const std::vector<std::string_view>& input) {
+    return IntegerTable{input};
+}
 
-        auto& currentSequence = sequences.emplace_back();
-        std::ranges::transform(splitString(line, ' '), std::back_inserter(currentSequence), convert);
-    } //for ( const auto& line : input )
-    return sequences;
+auto sequences(const IntegerTable& table) noexcept {
+    return table.rows() | std::views::filter([](Sequence sequence) noexcept { return !sequence.empty(); });
 }
 
 template<typename Accessor, typename Combination>
-std::int64_t extraPolateRow(const std::vector<std::int64_t>& row, const Accessor& accessor,
-                            const Combination& combination) noexcept {
+std::int64_t extraPolateRow(Sequence row, const Accessor& accessor, const Combination& combination) {
     std::vector<std::int64_t> nextRow(row.size() - 1);
     const auto                op = [](std::int64_t left, std::int64_t right) noexcept { return right - left; };
     std::ranges::transform(row, row | std::views::drop(1), nextRow.begin(), op);
@@ -38,27 +30,25 @@ std::int64_t extraPolateRow(const std::vector<std::int64_t>& row, const Accessor
     return combination(std::invoke(accessor, row), extraPolated);
 }
 
-std::int64_t extraPolateSequence(const Sequence& sequence) noexcept {
-    return extraPolateRow(sequence, static_cast<const std::int64_t& (Sequence::*)() const>(&Sequence::back),
-                          std::plus<>{});
+std::int64_t extraPolateSequence(Sequence sequence) {
+    return extraPolateRow(sequence, &Sequence::back, std::plus<>{});
 }
 
-std::int64_t extraPolateSequenceBackwards(const Sequence& sequence) noexcept {
-    return extraPolateRow(sequence, static_cast<const std::int64_t& (Sequence::*)() const>(&Sequence::front),
-                          std::minus<>{});
+std::int64_t extraPolateSequenceBackwards(Sequence sequence) {
+    return extraPolateRow(sequence, &Sequence::front, std::minus<>{});
 }
-} //namespace
-
-bool challenge9(const std::vector<std::string_view>& input) {
-    const auto sequences = parse(input);
 
-    const auto sum1 = std::ranges::fold_left(sequences | std::views::transform(extraPolateSequence), 0, std::plus<>{});
-
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+std::int64_t part1(const IntegerTable& table) {
+    return std::ranges::fold_left(sequences(table) | std::views::transform(extraPolateSequence), 0, std::plus<>{});
+}
 
-    const auto sum2 =
-        std::ranges::fold_left(sequences | std::views::transform(extraPolateSequenceBackwards), 0, std::plus<>{});
+std::int64_t part2(const IntegerTable& table) {
+    return std::ranges::fold_left(sequences(table) | std::views::transform(extraPolateSequenceBackwards), 0,
+                                  std::plus<>{});
+}
+} //namespace
 
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-    return sum1 == 1'974'232'246 && sum2 == 928;
+const Challenge& challenge9(void) noexcept {
+    static constexpr auto challenge = makeChallenge<parse, part1, part2>(9, 1'974'232'246, 928);
+    return challenge;
 }
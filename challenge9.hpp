@@ -1,9 +1,8 @@
 #ifndef CHALLENGE9_HPP
 #define CHALLENGE9_HPP
 
-#include <string_view>
-#include <vector>
+#include "challenge.hpp"
 
-bool challenge9(const std::vector<std::string_view>& input);
+const Challenge& challenge9(void) noexcept;
 
 #endif //CHALLENGE9_HPP
@@ -0,0 +1,54 @@
+#ifndef CHECKER_HPP
+#define CHECKER_HPP
+
+#include "generator.hpp"
+#include "helper.hpp"
+#include "print.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Zählt die Abweichungen der Prüfprogramme und gibt sie aus.
+ */
+class Checker {
+    public:
+    void expect(std::string_view what, std::int64_t result, std::int64_t expected) {
+        if ( result != expected ) {
+            myErr("{:s}: got {:d}, expected {:d}\n", what, result, expected);
+            ++Failures;
+        } //if ( result != expected )
+        ++Checks;
+        return;
+    }
+
+    /**
+     * @return Der Exit Code, 0 wenn nichts abwich.
+     */
+    int finish(void) const {
+        myPrint("{:d} checks, {:d} failed\n", Checks, Failures);
+        return Failures == 0 ? 0 : 1;
+    }
+
+    private:
+    std::int64_t Checks   = 0;
+    std::int64_t Failures = 0;
+};
+
+/**
+ * @brief Erzeugt eine Eingabe für die Challenge in input, die Zeilen zeigen dort hinein.
+ * @param[in,out] random Kann danach für weitere Zufallswerte zur selben Karte genutzt werden.
+ */
+inline std::vector<std::string_view> generateMap(std::int64_t challenge, Random& random, std::int64_t scale,
+                                                 std::string& input) {
+    findGenerator(challenge)(random, scale, input);
+    std::vector<std::string_view> ret;
+    std::ranges::copy(splitString(input, '\n'), std::back_inserter(ret));
+    return ret;
+}
+
+#endif //CHECKER_HPP
@@ -0,0 +1,181 @@
+#include "challenge17.hpp"
+#include "checker.hpp"
+#include "helper.hpp"
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace {
+constexpr auto unreachable = std::numeric_limits<std::int64_t>::max();
+
+std::int64_t routeOne(const std::vector<std::string_view>& map, const CrucibleQuery& query, ThreadPool& pool) {
+    return routeCrucibles(map, {&query, 1}, pool).front();
+}
+
+/**
+ * @brief Ein schlichter Dijkstra über Feld, Richtung und Schritte in diese Richtung, mit Heap und ohne Schätzung.
+ *
+ * Langsam, teilt aber nichts mit dem PathFinder der Challenge, ein Fehler in dessen Buckets oder Schätzung fällt hier
+ * auf. Wie dort ist das Ziel erreicht, sobald es betreten wird.
+ */
+std::int64_t referenceRoute(const std::vector<std::string_view>& map, const CrucibleQuery& query) {
+    if ( query.StartRow == query.TargetRow && query.StartColumn == query.TargetColumn ) {
+        return 0;
+    } //if ( query.StartRow == query.TargetRow && query.StartColumn == query.TargetColumn )
+
+    //Oben, rechts, unten, links. Abbiegen ist +1 oder +3, umdrehen ist nicht erlaubt.
+    constexpr std::array<std::ptrdiff_t, 4> rowDeltas{-1, 0, 1, 0};
+    constexpr std::array<std::ptrdiff_t, 4> columnDeltas{0, 1, 0, -1};
+
+    const auto rows     = map.size();
+    const auto columns  = map.front().size();
+    const auto minSteps = static_cast<std::size_t>(query.MinPerDirection);
+    const auto maxSteps = static_cast<std::size_t>(query.MaxPerDirection);
+    const auto index    = [columns, maxSteps](std::size_t row, std::size_t column, std::size_t direction,
+                                           std::size_t steps) noexcept {
+        return ((row * columns + column) * 4 + direction) * (maxSteps + 1) + steps;
+    };
+
+    //Kosten, Zeile, Spalte, Richtung und wie viele Schritte schon in diese Richtung gegangen wurden.
+    using State = std::tuple<std::int64_t, std::size_t, std::size_t, std::size_t, std::size_t>;
+    std::priority_queue<State, std::vector<State>, std::greater<>> queue;
+    std::vector<std::int64_t>                                      best(rows * columns * 4 * (maxSteps + 1),
+                                                                        unreachable);
+
+    auto move = [&](std::int64_t cost, std::size_t row, std::size_t column, std::size_t direction, std::size_t steps) {
+        //Über den Rand nach oben oder links wird die Zeile oder Spalte sehr groß und fällt damit auch raus.
+        const auto nextRow    = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(row) + rowDeltas[direction]);
+        const auto nextColumn = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(column) + columnDeltas[direction]);
+        if ( nextRow >= rows || nextColumn >= columns ) {
+            return;
+        } //if ( nextRow >= rows || nextColumn >= columns )
+
+        const auto nextCost = cost + (map[nextRow][nextColumn] - '0');
+        auto&      known    = best[index(nextRow, nextColumn, direction, steps)];
+        if ( nextCost < known ) {
+            known = nextCost;
+            queue.emplace(nextCost, nextRow, nextColumn, direction, steps);
+        } //if ( nextCost < known )
+        return;
+    };
+
+    for ( std::size_t direction = 0; direction < 4; ++direction ) {
+        move(0, query.StartRow, query.StartColumn, direction, 1);
+    } //for ( std::size_t direction = 0; direction < 4; ++direction )
+
+    while ( !queue.empty() ) {
+        const auto [cost, row, column, direction, steps] = queue.top();
+        queue.pop();
+        if ( row == query.TargetRow && column == query.TargetColumn ) {
+            return cost;
+        } //if ( row == query.TargetRow && column == query.TargetColumn )
+        if ( cost != best[index(row, column, direction, steps)] ) {
+            continue;
+        } //if ( cost != best[index(row, column, direction, steps)] )
+
+        if ( steps < maxSteps ) {
+            move(cost, row, column, direction, steps + 1);
+        } //if ( steps < maxSteps )
+        if ( steps > minSteps ) {
+            move(cost, row, column, (direction + 1) % 4, 1);
+            move(cost, row, column, (direction + 3) % 4, 1);
+        } //if ( steps > minSteps )
+    } //while ( !queue.empty() )
+    return unreachable;
+}
+
+/**
+ * @brief Eine Zeile, in der nie abgebogen werden kann. Mehr als MaxPerDirection Felder weit ist nichts erreichbar.
+ */
+void checkSingleRow(Checker& checker, ThreadPool& pool) {
+    const std::vector<std::string_view> map{"12345678"};
+    const std::vector<CrucibleQuery>    queries{
+        {0, 0, 0, 0, 0, 3}, {0, 0, 0, 3, 0, 3}, {0, 0, 0, 5, 0, 3}, {0, 7, 0, 4, 0, 3}, {0, 0, 0, 7, 3, 10},
+    };
+    const std::vector<std::int64_t> expected{0, 2 + 3 + 4, unreachable, 7 + 6 + 5, 2 + 3 + 4 + 5 + 6 + 7 + 8};
+
+    const auto results = routeCrucibles(map, queries, pool);
+    for ( std::size_t i = 0; i < queries.size(); ++i ) {
+        checker.expect(std::format("Single row, query {:d}", i), results[i], expected[i]);
+        checker.expect(std::format("Single row, query {:d} alone", i), routeOne(map, queries[i], pool), expected[i]);
+        checker.expect(std::format("Single row, query {:d} reference", i), referenceRoute(map, queries[i]),
+                       expected[i]);
+    } //for ( std::size_t i = 0; i < queries.size(); ++i )
+    return;
+}
+
+/**
+ * @brief Zufällige Anfragen auf einer generierten Karte, alle auf einmal gegen jede einzeln und gegen referenceRoute.
+ */
+void checkGeneratedMap(Checker& checker, ThreadPool& pool, std::uint64_t seed) {
+    Random      random{seed};
+    std::string input;
+    const auto  map = generateMap(17, random, 1, input);
+
+    const auto rows    = map.size();
+    const auto columns = map.front().size();
+
+    //Die Ecken müssen die Ergebnisse der Challenge selbst liefern, und die müssen zur Referenz passen.
+    const auto&         challenge = challenge17();
+    const auto          parsed    = challenge.Parse(map);
+    const CrucibleQuery normal{0, 0, rows - 1, columns - 1, 0, 3};
+    const CrucibleQuery ultra{0, 0, rows - 1, columns - 1, 3, 10};
+    checker.expect(std::format("Map {:d}, part 1", seed), challenge.Part1(parsed), referenceRoute(map, normal));
+    checker.expect(std::format("Map {:d}, part 2", seed), challenge.Part2(parsed), referenceRoute(map, ultra));
+    checker.expect(std::format("Map {:d}, part 1 route", seed), routeOne(map, normal, pool), challenge.Part1(parsed));
+    checker.expect(std::format("Map {:d}, part 2 route", seed), routeOne(map, ultra, pool), challenge.Part2(parsed));
+
+    std::vector<CrucibleQuery> queries;
+    for ( int i = 0; i < 24; ++i ) {
+        const auto    row    = random() % rows;
+        const auto    column = random() % columns;
+        CrucibleQuery query{row, column, random() % rows, random() % columns};
+        if ( i % 6 == 0 ) {
+            query.TargetRow    = row;
+            query.TargetColumn = column;
+        } //if ( i % 6 == 0 )
+        if ( i % 2 == 1 ) {
+            query.MinPerDirection = 3;
+            query.MaxPerDirection = 10;
+        } //if ( i % 2 == 1 )
+        queries.push_back(query);
+    } //for ( int i = 0; i < 24; ++i )
+
+    const auto results = routeCrucibles(map, queries, pool);
+    for ( std::size_t i = 0; i < queries.size(); ++i ) {
+        const auto expected = referenceRoute(map, queries[i]);
+        checker.expect(std::format("Map {:d}, query {:d}", seed, i), results[i], expected);
+        checker.expect(std::format("Map {:d}, query {:d} alone", seed, i), routeOne(map, queries[i], pool), expected);
+    } //for ( std::size_t i = 0; i < queries.size(); ++i )
+    return;
+}
+} //namespace
+
+/**
+ * @brief Prüft routeCrucibles gegen einen schlichten Dijkstra: viele Anfragen auf einmal und jede einzeln, die Ecken
+ * auch gegen die Challenge selbst.
+ *
+ * Aufruf: crucible-check [maps]
+ * @return 0, wenn jede Route so lang ist wie die des Dijkstra.
+ */
+int main(int argc, const char* argv[]) {
+    const auto maps = argc > 1 ? convert(argv[1]) : 3;
+
+    Checker    checker;
+    ThreadPool pool{4};
+    checkSingleRow(checker, pool);
+    for ( std::int64_t seed = 1; seed <= maps; ++seed ) {
+        checkGeneratedMap(checker, pool, static_cast<std::uint64_t>(seed));
+    } //for ( std::int64_t seed = 1; seed <= maps; ++seed )
+    return checker.finish();
+}
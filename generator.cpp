@@ -0,0 +1,1034 @@
+#include "generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace {
+std::int64_t uniform(Random& random, std::int64_t min, std::int64_t max) {
+    return std::uniform_int_distribution<std::int64_t>{min, max}(random);
+}
+
+std::size_t uniformIndex(Random& random, std::size_t size) {
+    return std::uniform_int_distribution<std::size_t>{0, size - 1}(random);
+}
+
+bool chance(Random& random, double probability) {
+    return std::bernoulli_distribution{probability}(random);
+}
+
+char pick(Random& random, std::string_view characters) {
+    return characters[uniformIndex(random, characters.size())];
+}
+
+constexpr auto lowerCase = "abcdefghijklmnopqrstuvwxyz"sv;
+
+/**
+ * @brief Liefert zufällige, eindeutige Namen aus den angegebenen Zeichen.
+ */
+class NameGenerator {
+    public:
+    NameGenerator(std::string_view characters, std::size_t minLength, std::size_t maxLength) noexcept :
+            Characters{characters}, MinLength{minLength}, MaxLength{maxLength} {
+        return;
+    }
+
+    void reserve(std::string name) {
+        Used.insert(std::move(name));
+        return;
+    }
+
+    std::string operator()(Random& random) {
+        for ( ;; ) {
+            std::string name(static_cast<std::size_t>(uniform(random, static_cast<std::int64_t>(MinLength),
+                                                              static_cast<std::int64_t>(MaxLength))),
+                             ' ');
+            std::ranges::generate(name, [this, &random](void) { return pick(random, Characters); });
+            if ( Used.insert(name).second ) {
+                return name;
+            } //if ( Used.insert(name).second )
+        } //for ( ;; )
+    }
+
+    private:
+    std::string_view                Characters;
+    std::size_t                     MinLength;
+    std::size_t                     MaxLength;
+    std::unordered_set<std::string> Used;
+};
+
+std::vector<std::int64_t> primesBetween(std::int64_t min, std::int64_t max) {
+    std::vector<std::int64_t> ret;
+    for ( auto candidate = std::max<std::int64_t>(min, 2); candidate <= max; ++candidate ) {
+        bool isPrime = true;
+        for ( std::int64_t divisor = 2; divisor * divisor <= candidate; ++divisor ) {
+            if ( candidate % divisor == 0 ) {
+                isPrime = false;
+                break;
+            } //if ( candidate % divisor == 0 )
+        } //for ( std::int64_t divisor = 2; divisor * divisor <= candidate; ++divisor )
+        if ( isPrime ) {
+            ret.push_back(candidate);
+        } //if ( isPrime )
+    } //for ( auto candidate = std::max<std::int64_t>(min, 2); candidate <= max; ++candidate )
+    return ret;
+}
+
+void appendGrid(const std::vector<std::string>& grid, std::string& out) {
+    for ( const auto& row : grid ) {
+        out += row;
+        out += '\n';
+    } //for ( const auto& row : grid )
+    return;
+}
+
+std::vector<std::string> randomGrid(Random& random, std::size_t rows, std::size_t columns,
+                                    std::string_view weightedCharacters) {
+    std::vector<std::string> ret(rows, std::string(columns, ' '));
+    for ( auto& row : ret ) {
+        std::ranges::generate(row, [&random, weightedCharacters](void) { return pick(random, weightedCharacters); });
+    } //for ( auto& row : ret )
+    return ret;
+}
+
+void generate1(Random& random, std::int64_t scale, std::string& out) {
+    constexpr std::array names{"one"sv, "two"sv,   "three"sv, "four"sv, "five"sv,
+                               "six"sv, "seven"sv, "eight"sv, "nine"sv};
+
+    for ( std::int64_t line = 0; line < 1000 * scale; ++line ) {
+        const auto lineStart = out.size();
+        bool       hasDigit  = false;
+        for ( auto pieces = uniform(random, 2, 12); pieces > 0; --pieces ) {
+            switch ( uniform(random, 0, 9) ) {
+                case 0 :
+                case 1 : {
+                    out      += pick(random, "123456789"sv);
+                    hasDigit  = true;
+                    break;
+                } //case 0 & 1
+
+                case 2 :
+                case 3  : out += names[uniformIndex(random, names.size())]; break;
+                default : out += pick(random, lowerCase); break;
+            } //switch ( uniform(random, 0, 9) )
+        } //for ( auto pieces = uniform(random, 2, 12); pieces > 0; --pieces )
+
+        if ( !hasDigit ) {
+            //Teil 1 braucht mindestens eine Ziffer.
+            out.insert(lineStart + uniformIndex(random, out.size() - lineStart + 1), 1, pick(random, "123456789"sv));
+        } //if ( !hasDigit )
+        out += '\n';
+    } //for ( std::int64_t line = 0; line < 1000 * scale; ++line )
+    return;
+}
+
+void generate2(Random& random, std::int64_t scale, std::string& out) {
+    constexpr std::array colors{"red"sv, "green"sv, "blue"sv};
+
+    for ( std::int64_t game = 1; game <= 100 * scale; ++game ) {
+        std::format_to(std::back_inserter(out), "Game {:d}:", game);
+        for ( auto draws = uniform(random, 1, 6); draws > 0; --draws ) {
+            auto drawColors = colors;
+            std::ranges::shuffle(drawColors, random);
+            const auto numberOfColors = static_cast<std::size_t>(uniform(random, 1, 3));
+            for ( std::size_t color = 0; color < numberOfColors; ++color ) {
+                std::format_to(std::back_inserter(out), " {:d} {:s}{:s}", uniform(random, 1, 20), drawColors[color],
+                               color + 1 < numberOfColors ? ","
+                               : draws > 1                ? ";"
+                                                          : "");
+            } //for ( std::size_t color = 0; color < numberOfColors; ++color )
+        } //for ( auto draws = uniform(random, 1, 6); draws > 0; --draws )
+        out += '\n';
+    } //for ( std::int64_t game = 1; game <= 100 * scale; ++game )
+    return;
+}
+
+void generate3(Random& random, std::int64_t scale, std::string& out) {
+    const auto size = static_cast<std::size_t>(140 * scale);
+    auto       grid = std::vector<std::string>(size, std::string(size, '.'));
+
+    for ( auto& row : grid ) {
+        for ( std::size_t column = static_cast<std::size_t>(uniform(random, 0, 3)); column < size; ) {
+            const auto digits = static_cast<std::size_t>(uniform(random, 1, 3));
+            if ( column + digits > size ) {
+                break;
+            } //if ( column + digits > size )
+
+            const auto number = std::format("{:d}", uniform(random, digits == 1 ? 1 : digits == 2 ? 10 : 100,
+                                                            digits == 1   ? 9
+                                                            : digits == 2 ? 99
+                                                                          : 999));
+            std::ranges::copy(number, row.begin() + static_cast<std::ptrdiff_t>(column));
+            //Mindestens ein Punkt Abstand, sonst verschmelzen die Zahlen.
+            column += digits + static_cast<std::size_t>(uniform(random, 1, 8));
+        } //for ( std::size_t column = ...; column < size; )
+    } //for ( auto& row : grid )
+
+    for ( auto& row : grid ) {
+        for ( auto& field : row ) {
+            if ( field == '.' && chance(random, .06) ) {
+                field = chance(random, .4) ? '*' : pick(random, "#+$/@=%&-"sv);
+            } //if ( field == '.' && chance(random, .06) )
+        } //for ( auto& field : row )
+    } //for ( auto& row : grid )
+
+    appendGrid(grid, out);
+    return;
+}
+
+void generate4(Random& random, std::int64_t scale, std::string& out) {
+    const auto numberOfCards = 200 * scale;
+    const auto cardWidth     = std::format("{:d}", numberOfCards).size();
+    std::vector<std::int64_t> allNumbers(99);
+    std::iota(allNumbers.begin(), allNumbers.end(), 1);
+
+    for ( std::int64_t card = 1; card <= numberOfCards; ++card ) {
+        //Im Schnitt weniger als ein Treffer pro Karte, sonst explodiert die Anzahl der Kopien in Teil 2.
+        auto matches = chance(random, .85) ? 0 : uniform(random, 1, 10);
+        matches      = std::min(matches, numberOfCards - card);
+
+        std::ranges::shuffle(allNumbers, random);
+        std::vector<std::int64_t> winning{allNumbers.begin(), allNumbers.begin() + 10};
+        std::vector<std::int64_t> numbers{allNumbers.begin(), allNumbers.begin() + matches};
+        numbers.insert(numbers.end(), allNumbers.begin() + 10, allNumbers.begin() + 10 + (25 - matches));
+        std::ranges::shuffle(numbers, random);
+
+        std::format_to(std::back_inserter(out), "Card {:>{}d}:", card, cardWidth);
+        for ( auto number : winning ) {
+            std::format_to(std::back_inserter(out), " {:>2d}", number);
+        } //for ( auto number : winning )
+        out += " |";
+        for ( auto number : numbers ) {
+            std::format_to(std::back_inserter(out), " {:>2d}", number);
+        } //for ( auto number : numbers )
+        out += '\n';
+    } //for ( std::int64_t card = 1; card <= numberOfCards; ++card )
+    return;
+}
+
+void generate5(Random& random, std::int64_t scale, std::string& out) {
+    constexpr std::int64_t universe = std::int64_t{1} << 32;
+    constexpr std::array   mapNames{"seed-to-soil"sv,         "soil-to-fertilizer"sv,    "fertilizer-to-water"sv,
+                                  "water-to-light"sv,       "light-to-temperature"sv, "temperature-to-humidity"sv,
+                                  "humidity-to-location"sv};
+
+    out += "seeds:";
+    for ( int pair = 0; pair < 10; ++pair ) {
+        const auto length = std::min(uniform(random, 5'000'000, 200'000'000) * scale, universe / 20);
+        std::format_to(std::back_inserter(out), " {:d} {:d}", uniform(random, 0, universe - length), length);
+    } //for ( int pair = 0; pair < 10; ++pair )
+    out += '\n';
+
+    for ( auto mapName : mapNames ) {
+        //Die Quellbereiche zerlegen das Universum, die Ziele sind eine Permutation davon.
+        std::vector<std::int64_t> cuts{0, universe};
+        for ( auto entries = 30 * scale - 1; entries > 0; --entries ) {
+            cuts.push_back(uniform(random, 1, universe - 1));
+        } //for ( auto entries = 30 * scale - 1; entries > 0; --entries )
+        std::ranges::sort(cuts);
+        cuts.erase(std::ranges::unique(cuts).begin(), cuts.end());
+
+        std::vector<std::pair<std::int64_t, std::int64_t>> blocks;
+        for ( std::size_t i = 1; i < cuts.size(); ++i ) {
+            blocks.emplace_back(cuts[i - 1], cuts[i] - cuts[i - 1]);
+        } //for ( std::size_t i = 1; i < cuts.size(); ++i )
+        std::ranges::shuffle(blocks, random);
+
+        std::format_to(std::back_inserter(out), "\n{:s} map:\n", mapName);
+        std::int64_t destination = 0;
+        for ( auto [source, length] : blocks ) {
+            std::format_to(std::back_inserter(out), "{:d} {:d} {:d}\n", destination, source, length);
+            destination += length;
+        } //for ( auto [source, length] : blocks )
+    } //for ( auto mapName : mapNames )
+    return;
+}
+
+void generate6(Random& random, std::int64_t scale, std::string& out) {
+    //Teil 2 hängt die Zahlen aneinander, T² muss also noch in 64 Bit passen. Mehr als 3 Rennen mit 3 Ziffern geht
+    //nicht.
+    const auto numberOfRaces = scale == 1 ? 4 : 3;
+    const auto minTime       = scale == 1 ? 40 : 400;
+    const auto maxTime       = scale == 1 ? 99 : 999;
+
+    for ( ;; ) {
+        std::vector<std::int64_t> times;
+        std::vector<std::int64_t> distances;
+        std::string               overallTime;
+        std::string               overallDistance;
+        for ( int race = 0; race < numberOfRaces; ++race ) {
+            const auto time     = uniform(random, minTime, maxTime);
+            const auto best     = (time / 2) * (time - time / 2);
+            const auto distance = uniform(random, best / 2, best - 1);
+            times.push_back(time);
+            distances.push_back(distance);
+            overallTime     += std::format("{:d}", time);
+            overallDistance += std::format("{:d}", distance);
+        } //for ( int race = 0; race < numberOfRaces; ++race )
+
+        const auto time     = std::stoll(overallTime);
+        const auto distance = std::stoll(overallDistance);
+        if ( distance >= (time / 2) * (time - time / 2) ) {
+            continue;
+        } //if ( distance >= (time / 2) * (time - time / 2) )
+
+        out += "Time:    ";
+        for ( auto t : times ) {
+            std::format_to(std::back_inserter(out), " {:>6d}", t);
+        } //for ( auto t : times )
+        out += "\nDistance:";
+        for ( auto d : distances ) {
+            std::format_to(std::back_inserter(out), " {:>6d}", d);
+        } //for ( auto d : distances )
+        out += '\n';
+        return;
+    } //for ( ;; )
+}
+
+void generate7(Random& random, std::int64_t scale, std::string& out) {
+    //Es gibt nur 13^5 verschiedene Hände.
+    const auto                      numberOfHands = std::min<std::int64_t>(1000 * scale, 300'000);
+    std::unordered_set<std::string> hands;
+
+    while ( static_cast<std::int64_t>(hands.size()) < numberOfHands ) {
+        std::string hand(5, ' ');
+        std::ranges::generate(hand, [&random](void) { return pick(random, "23456789TJQKA"sv); });
+        if ( hands.insert(hand).second ) {
+            std::format_to(std::back_inserter(out), "{:s} {:d}\n", hand, uniform(random, 1, 1000));
+        } //if ( hands.insert(hand).second )
+    } //while ( static_cast<std::int64_t>(hands.size()) < numberOfHands )
+    return;
+}
+
+void generate8(Random& random, std::int64_t scale, std::string& out) {
+    //Das Ergebnis von Teil 2 ist das Produkt der Zyklenlängen, die müssen also klein genug bleiben.
+    constexpr auto numberOfGhosts = 6uz;
+    const auto     maxPrime       = std::min<std::int64_t>(80 * scale, 1300);
+    auto           primes         = primesBetween(std::min<std::int64_t>(40 * scale, 1200), maxPrime);
+    std::ranges::shuffle(primes, random);
+
+    NameGenerator names{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"sv, 3, 3};
+    names.reserve("AAA");
+    names.reserve("ZZZ");
+
+    auto nameEndingIn = [&names, &random](auto predicate) {
+        for ( ;; ) {
+            if ( auto name = names(random); predicate(name.back()) ) {
+                return name;
+            } //if ( auto name = names(random); predicate(name.back()) )
+        } //for ( ;; )
+    };
+
+    //Start und Ziel zuerst, sonst sind die Namen womöglich schon durch die Knoten verbraucht.
+    std::vector<std::string> starts{"AAA"};
+    std::vector<std::string> ends{"ZZZ"};
+    while ( starts.size() < numberOfGhosts ) {
+        starts.push_back(nameEndingIn([](char c) noexcept { return c == 'A'; }));
+        ends.push_back(nameEndingIn([](char c) noexcept { return c == 'Z'; }));
+    } //while ( starts.size() < numberOfGhosts )
+
+    auto nodeName = [&nameEndingIn](void) {
+        return nameEndingIn([](char c) noexcept { return c != 'A' && c != 'Z'; });
+    };
+
+    std::string directions(static_cast<std::size_t>(uniform(random, 250, 300) * scale), ' ');
+    std::ranges::generate(directions, [&random](void) { return pick(random, "LR"sv); });
+    std::format_to(std::back_inserter(out), "{:s}\n\n", directions);
+
+    std::vector<std::string> nodes;
+    auto addNode = [&nodes](std::string_view name, std::string_view left, std::string_view right) {
+        nodes.push_back(std::format("{:s} = ({:s}, {:s})", name, left, right));
+        return;
+    };
+
+    for ( std::size_t ghost = 0; ghost < numberOfGhosts; ++ghost ) {
+        const auto  steps = primes[ghost % primes.size()];
+        const auto& start = starts[ghost];
+        const auto& end   = ends[ghost];
+
+        //Zwei parallele Stränge, egal ob links oder rechts, nach steps Schritten ist man auf end.
+        std::array<std::string, 2> level{nodeName(), nodeName()};
+        const auto                 first = level;
+        addNode(start, first[0], first[1]);
+        addNode(end, first[0], first[1]);
+        for ( std::int64_t step = 2; step < steps; ++step ) {
+            std::array<std::string, 2> next{nodeName(), nodeName()};
+            for ( const auto& node : level ) {
+                chance(random, .5) ? addNode(node, next[0], next[1]) : addNode(node, next[1], next[0]);
+            } //for ( const auto& node : level )
+            level = std::move(next);
+        } //for ( std::int64_t step = 2; step < steps; ++step )
+        for ( const auto& node : level ) {
+            addNode(node, end, end);
+        } //for ( const auto& node : level )
+    } //for ( std::size_t ghost = 0; ghost < numberOfGhosts; ++ghost )
+
+    std::ranges::shuffle(nodes, random);
+    for ( const auto& node : nodes ) {
+        out += node;
+        out += '\n';
+    } //for ( const auto& node : nodes )
+    return;
+}
+
+void generate9(Random& random, std::int64_t scale, std::string& out) {
+    constexpr auto length = 21;
+
+    for ( std::int64_t line = 0; line < 200 * scale; ++line ) {
+        //Ein Polynom über die Differenzen, ganz unten konstant.
+        const auto                degree = static_cast<std::size_t>(uniform(random, 0, 15));
+        std::vector<std::int64_t> differences(degree + 1);
+        std::ranges::generate(differences, [&random](void) { return uniform(random, -20, 20); });
+
+        for ( int i = 0; i < length; ++i ) {
+            std::format_to(std::back_inserter(out), "{:s}{:d}", i == 0 ? "" : " ", differences.front());
+            for ( std::size_t d = 0; d < degree; ++d ) {
+                differences[d] += differences[d + 1];
+            } //for ( std::size_t d = 0; d < degree; ++d )
+        } //for ( int i = 0; i < length; ++i )
+        out += '\n';
+    } //for ( std::int64_t line = 0; line < 200 * scale; ++line )
+    return;
+}
+
+/**
+ * @brief Eine x-monotone rechtwinklige Schleife, die Zeilen wachsen nach unten.
+ *
+ * Für jeden Abschnitt i gibt es die obere Zeile Top[i] und die untere Bottom[i], die Breite ist Width[i]. Die Schleife
+ * ist einfach, solange sich benachbarte Abschnitte überlappen.
+ */
+struct MonotoneLoop {
+    std::vector<std::int64_t> Top;
+    std::vector<std::int64_t> Bottom;
+    std::vector<std::int64_t> Width;
+};
+
+MonotoneLoop randomMonotoneLoop(Random& random, std::size_t sections, std::int64_t maxWidth, std::int64_t maxStep,
+                                std::int64_t maxHeight, std::int64_t minRow, std::int64_t maxRow) {
+    MonotoneLoop ret;
+    ret.Top.push_back(uniform(random, minRow, maxRow - 1));
+    ret.Bottom.push_back(uniform(random, ret.Top.back() + 1, std::min(maxRow, ret.Top.back() + maxStep)));
+    ret.Width.push_back(uniform(random, 1, maxWidth));
+
+    while ( ret.Top.size() < sections ) {
+        const auto top       = ret.Top.back();
+        const auto bottom    = ret.Bottom.back();
+        const auto newTop    = std::clamp(top + uniform(random, -maxStep, maxStep), minRow, maxRow);
+        const auto newBottom = std::clamp(bottom + uniform(random, -maxStep, maxStep), minRow, maxRow);
+
+        //Keine Kante der Länge 0 und die Abschnitte müssen sich überlappen.
+        if ( newTop == top || newBottom == bottom || std::max(top, newTop) >= std::min(bottom, newBottom) ||
+             newBottom - newTop > maxHeight ) {
+            continue;
+        } //if ( newTop == top || ... )
+
+        ret.Top.push_back(newTop);
+        ret.Bottom.push_back(newBottom);
+        ret.Width.push_back(uniform(random, 1, maxWidth));
+    } //while ( ret.Top.size() < sections )
+    return ret;
+}
+
+/**
+ * @brief Die Kanten der Schleife im Uhrzeigersinn, beginnend oben links nach rechts.
+ * @return Paare aus Richtung (R, D, L, U) und Länge.
+ */
+std::vector<std::pair<char, std::int64_t>> loopEdges(const MonotoneLoop& loop) {
+    std::vector<std::pair<char, std::int64_t>> ret;
+    const auto                                 sections = loop.Top.size();
+    auto addVertical = [&ret](std::int64_t from, std::int64_t to) {
+        if ( from != to ) {
+            ret.emplace_back(to > from ? 'D' : 'U', std::abs(to - from));
+        } //if ( from != to )
+        return;
+    };
+
+    for ( std::size_t i = 0; i < sections; ++i ) {
+        ret.emplace_back('R', loop.Width[i]);
+        if ( i + 1 < sections ) {
+            addVertical(loop.Top[i], loop.Top[i + 1]);
+        } //if ( i + 1 < sections )
+    } //for ( std::size_t i = 0; i < sections; ++i )
+    addVertical(loop.Top.back(), loop.Bottom.back());
+    for ( std::size_t i = sections; i > 0; --i ) {
+        ret.emplace_back('L', loop.Width[i - 1]);
+        if ( i > 1 ) {
+            addVertical(loop.Bottom[i - 1], loop.Bottom[i - 2]);
+        } //if ( i > 1 )
+    } //for ( std::size_t i = sections; i > 0; --i )
+    addVertical(loop.Bottom.front(), loop.Top.front());
+    return ret;
+}
+
+void generate10(Random& random, std::int64_t scale, std::string& out) {
+    const auto size    = 140 * scale;
+    auto       grid    = randomGrid(random, static_cast<std::size_t>(size), static_cast<std::size_t>(size),
+                                    "...|-LJ7F"sv);
+    const auto columns = (size - 4) / 2;
+    const auto loop = randomMonotoneLoop(random, static_cast<std::size_t>(columns), 2, size / 4, size, 1, size - 2);
+
+    //Die Schleife Feld für Feld ablaufen.
+    std::vector<std::pair<std::int64_t, std::int64_t>> tiles;
+    std::int64_t                                       row    = loop.Top.front();
+    std::int64_t                                       column = 1;
+    for ( auto [direction, length] : loopEdges(loop) ) {
+        for ( ; length > 0; --length ) {
+            tiles.emplace_back(row, column);
+            switch ( direction ) {
+                case 'R' : ++column; break;
+                case 'L' : --column; break;
+                case 'D' : ++row; break;
+                case 'U' : --row; break;
+            } //switch ( direction )
+        } //for ( ; length > 0; --length )
+    } //for ( auto [direction, length] : loopEdges(loop) )
+
+    auto pipe = [](std::pair<std::int64_t, std::int64_t> tile, std::pair<std::int64_t, std::int64_t> a,
+                   std::pair<std::int64_t, std::int64_t> b) noexcept {
+        const auto connects = [tile, a, b](std::int64_t rowDelta, std::int64_t columnDelta) noexcept {
+            const std::pair neighbor{tile.first + rowDelta, tile.second + columnDelta};
+            return neighbor == a || neighbor == b;
+        };
+        const bool north = connects(-1, 0);
+        const bool south = connects(1, 0);
+        const bool west  = connects(0, -1);
+        const bool east  = connects(0, 1);
+        return north && south ? '|'
+             : west && east   ? '-'
+             : north && east  ? 'L'
+             : north && west  ? 'J'
+             : south && west  ? '7'
+                              : 'F';
+    };
+
+    for ( std::size_t i = 0; i < tiles.size(); ++i ) {
+        const auto tile = tiles[i];
+        grid[static_cast<std::size_t>(tile.first)][static_cast<std::size_t>(tile.second)] =
+            pipe(tile, tiles[(i + tiles.size() - 1) % tiles.size()], tiles[(i + 1) % tiles.size()]);
+    } //for ( std::size_t i = 0; i < tiles.size(); ++i )
+
+    const auto animalIndex = uniformIndex(random, tiles.size());
+    const auto animal      = tiles[animalIndex];
+    const auto previous    = tiles[(animalIndex + tiles.size() - 1) % tiles.size()];
+    const auto next        = tiles[(animalIndex + 1) % tiles.size()];
+    grid[static_cast<std::size_t>(animal.first)][static_cast<std::size_t>(animal.second)] = 'S';
+
+    //Nur die beiden Nachbarn der Schleife dürfen zum Tier zeigen.
+    std::unordered_set<std::int64_t> onLoop;
+    for ( auto [r, c] : tiles ) {
+        onLoop.insert(r * size + c);
+    } //for ( auto [r, c] : tiles )
+    for ( auto [rowDelta, columnDelta] : {std::pair{-1, 0}, std::pair{1, 0}, std::pair{0, -1}, std::pair{0, 1}} ) {
+        const std::pair neighbor{animal.first + rowDelta, animal.second + columnDelta};
+        if ( neighbor != previous && neighbor != next && !onLoop.contains(neighbor.first * size + neighbor.second) ) {
+            grid[static_cast<std::size_t>(neighbor.first)][static_cast<std::size_t>(neighbor.second)] = '.';
+        } //if ( neighbor != previous && neighbor != next && !onLoop.contains(...) )
+    } //for ( auto [rowDelta, columnDelta] : ... )
+
+    appendGrid(grid, out);
+    return;
+}
+
+void generate11(Random& random, std::int64_t scale, std::string& out) {
+    const auto size = static_cast<std::size_t>(140 * scale);
+    auto       grid = randomGrid(random, size, size, "........................................#"sv);
+
+    for ( std::size_t i = 0; i < size; ++i ) {
+        if ( chance(random, .05) ) {
+            grid[i].assign(size, '.');
+        } //if ( chance(random, .05) )
+        if ( chance(random, .05) ) {
+            for ( auto& row : grid ) {
+                row[i] = '.';
+            } //for ( auto& row : grid )
+        } //if ( chance(random, .05) )
+    } //for ( std::size_t i = 0; i < size; ++i )
+
+    appendGrid(grid, out);
+    return;
+}
+
+void generate12(Random& random, std::int64_t scale, std::string& out) {
+    for ( std::int64_t line = 0; line < 1000 * scale; ++line ) {
+        //Die Länge bleibt so klein wie im Original, Teil 1 probiert alle Permutationen durch.
+        const auto                length = static_cast<std::size_t>(uniform(random, 4, 20));
+        std::string               springs(length, '.');
+        std::vector<std::int64_t> groups;
+
+        for ( std::size_t position = static_cast<std::size_t>(uniform(random, 0, 2)); position < length; ) {
+            const auto groupLength =
+                std::min(static_cast<std::size_t>(uniform(random, 1, 5)), length - position);
+            std::fill_n(springs.begin() + static_cast<std::ptrdiff_t>(position), groupLength, '#');
+            groups.push_back(static_cast<std::int64_t>(groupLength));
+            position += groupLength + static_cast<std::size_t>(uniform(random, 1, 4));
+        } //for ( std::size_t position = ...; position < length; )
+
+        for ( auto& spring : springs ) {
+            if ( chance(random, .5) ) {
+                spring = '?';
+            } //if ( chance(random, .5) )
+        } //for ( auto& spring : springs )
+
+        out += springs;
+        for ( std::size_t i = 0; i < groups.size(); ++i ) {
+            std::format_to(std::back_inserter(out), "{:c}{:d}", i == 0 ? ' ' : ',', groups[i]);
+        } //for ( std::size_t i = 0; i < groups.size(); ++i )
+        out += '\n';
+    } //for ( std::int64_t line = 0; line < 1000 * scale; ++line )
+    return;
+}
+
+/**
+ * @brief Zählt für jede Spiegelachse zwischen den Zeilen die Unterschiede.
+ */
+std::vector<std::int64_t> mirrorDifferences(const std::vector<std::string>& rows) {
+    std::vector<std::int64_t> ret;
+    for ( std::size_t axis = 1; axis < rows.size(); ++axis ) {
+        std::int64_t differences = 0;
+        for ( std::size_t above = axis, below = axis; above > 0 && below < rows.size(); --above, ++below ) {
+            for ( std::size_t column = 0; column < rows[0].size(); ++column ) {
+                differences += rows[above - 1][column] != rows[below][column];
+            } //for ( std::size_t column = 0; column < rows[0].size(); ++column )
+        } //for ( std::size_t above = axis, below = axis; above > 0 && below < rows.size(); --above, ++below )
+        ret.push_back(differences);
+    } //for ( std::size_t axis = 1; axis < rows.size(); ++axis )
+    return ret;
+}
+
+std::vector<std::string> transposed(const std::vector<std::string>& rows) {
+    std::vector<std::string> ret(rows[0].size(), std::string(rows.size(), ' '));
+    for ( std::size_t row = 0; row < rows.size(); ++row ) {
+        for ( std::size_t column = 0; column < rows[0].size(); ++column ) {
+            ret[column][row] = rows[row][column];
+        } //for ( std::size_t column = 0; column < rows[0].size(); ++column )
+    } //for ( std::size_t row = 0; row < rows.size(); ++row )
+    return ret;
+}
+
+void generate13(Random& random, std::int64_t scale, std::string& out) {
+    for ( std::int64_t pattern = 0; pattern < 100 * scale; ++pattern ) {
+        for ( ;; ) {
+            //Zwei getrennte Spiegelbereiche: oben ein perfekter, unten einer mit genau einem Fleck.
+            const auto perfect  = static_cast<std::size_t>(uniform(random, 1, 3));
+            const auto smudged  = static_cast<std::size_t>(uniform(random, 1, 3));
+            const auto rowCount = static_cast<std::size_t>(
+                uniform(random, static_cast<std::int64_t>(2 * (perfect + smudged) + 1), 17));
+            auto rows = randomGrid(random, rowCount, static_cast<std::size_t>(uniform(random, 7, 17)), "#."sv);
+
+            for ( std::size_t i = 0; i < perfect; ++i ) {
+                rows[2 * perfect - 1 - i] = rows[i];
+            } //for ( std::size_t i = 0; i < perfect; ++i )
+            for ( std::size_t i = 0; i < smudged; ++i ) {
+                rows[rowCount - 1 - i] = rows[rowCount - 2 * smudged + i];
+            } //for ( std::size_t i = 0; i < smudged; ++i )
+            auto& smudge = rows[rowCount - 1 - uniformIndex(random, smudged)][uniformIndex(random, rows[0].size())];
+            smudge       = smudge == '#' ? '.' : '#';
+
+            auto differences = mirrorDifferences(rows);
+            std::ranges::copy(mirrorDifferences(transposed(rows)), std::back_inserter(differences));
+            if ( std::ranges::count(differences, 0) != 1 || std::ranges::count(differences, 1) != 1 ) {
+                continue;
+            } //if ( std::ranges::count(differences, 0) != 1 || std::ranges::count(differences, 1) != 1 )
+
+            appendGrid(chance(random, .5) ? rows : transposed(rows), out);
+            break;
+        } //for ( ;; )
+        out += '\n';
+    } //for ( std::int64_t pattern = 0; pattern < 100 * scale; ++pattern )
+    return;
+}
+
+void generate14(Random& random, std::int64_t scale, std::string& out) {
+    const auto size = static_cast<std::size_t>(100 * scale);
+    appendGrid(randomGrid(random, size, size, "......OO##"sv), out);
+    return;
+}
+
+void generate15(Random& random, std::int64_t scale, std::string& out) {
+    NameGenerator            labelGenerator{lowerCase, 2, 6};
+    std::vector<std::string> labels(static_cast<std::size_t>(std::max<std::int64_t>(50, 400 * scale)));
+    std::ranges::generate(labels, [&labelGenerator, &random](void) { return labelGenerator(random); });
+
+    for ( std::int64_t step = 0; step < 4000 * scale; ++step ) {
+        const auto& label = labels[uniformIndex(random, labels.size())];
+        if ( chance(random, .3) ) {
+            std::format_to(std::back_inserter(out), "{:s}{:s}-", step == 0 ? "" : ",", label);
+        } //if ( chance(random, .3) )
+        else {
+            std::format_to(std::back_inserter(out), "{:s}{:s}={:d}", step == 0 ? "" : ",", label,
+                           uniform(random, 1, 9));
+        } //else -> if ( chance(random, .3) )
+    } //for ( std::int64_t step = 0; step < 4000 * scale; ++step )
+    out += '\n';
+    return;
+}
+
+void generate16(Random& random, std::int64_t scale, std::string& out) {
+    const auto size = static_cast<std::size_t>(110 * scale);
+    appendGrid(randomGrid(random, size, size, "..................../\\|-"sv), out);
+    return;
+}
+
+void generate17(Random& random, std::int64_t scale, std::string& out) {
+    const auto size = static_cast<std::size_t>(141 * scale);
+    appendGrid(randomGrid(random, size, size, "123456789"sv), out);
+    return;
+}
+
+void generate18(Random& random, std::int64_t scale, std::string& out) {
+    //Zwei unabhängige Schleifen mit gleich vielen Kanten, die zweite steckt in den Farben. Da passen nur 5
+    //Hexziffern rein.
+    const auto sections = static_cast<std::size_t>(170 * scale);
+    const auto dig = loopEdges(randomMonotoneLoop(random, sections, 10, 8, 400, -200'000, 200'000));
+    const auto color =
+        loopEdges(randomMonotoneLoop(random, sections, 0xFFFFF, 0x3FFFF, 0xFFFFF, -100'000'000, 100'000'000));
+    constexpr auto directions = "RDLU"sv;
+
+    for ( std::size_t i = 0; i < dig.size(); ++i ) {
+        std::format_to(std::back_inserter(out), "{:c} {:d} (#{:05x}{:d})\n", dig[i].first, dig[i].second,
+                       color[i].second, directions.find(color[i].first));
+    } //for ( std::size_t i = 0; i < dig.size(); ++i )
+    return;
+}
+
+void generate19(Random& random, std::int64_t scale, std::string& out) {
+    constexpr auto attributes = "xmas"sv;
+    NameGenerator  names{lowerCase, 2, 4};
+    names.reserve("in");
+
+    //Die Workflows bilden einen Baum, damit gibt es keine Schleifen.
+    const auto               numberOfWorkflows = 550 * scale;
+    std::int64_t             created           = 1;
+    std::vector<std::string> toCreate{"in"};
+    std::vector<std::string> workflows;
+
+    while ( !toCreate.empty() ) {
+        const auto name = std::move(toCreate.back());
+        toCreate.pop_back();
+
+        auto target = [&](void) {
+            if ( created < numberOfWorkflows && chance(random, .6) ) {
+                ++created;
+                return toCreate.emplace_back(names(random));
+            } //if ( created < numberOfWorkflows && chance(random, .6) )
+            return std::string{chance(random, .5) ? "A" : "R"};
+        };
+
+        auto workflow = name + '{';
+        for ( auto rules = uniform(random, 1, 4); rules > 0; --rules ) {
+            std::format_to(std::back_inserter(workflow), "{:c}{:c}{:d}:{:s},", pick(random, attributes),
+                           pick(random, "<>"sv), uniform(random, 1, 4000), target());
+        } //for ( auto rules = uniform(random, 1, 4); rules > 0; --rules )
+        workflow += target();
+        workflow += '}';
+        workflows.push_back(std::move(workflow));
+    } //while ( !toCreate.empty() )
+
+    std::ranges::shuffle(workflows, random);
+    for ( const auto& workflow : workflows ) {
+        out += workflow;
+        out += '\n';
+    } //for ( const auto& workflow : workflows )
+    out += '\n';
+
+    for ( std::int64_t piece = 0; piece < 200 * scale; ++piece ) {
+        std::format_to(std::back_inserter(out), "{{x={:d},m={:d},a={:d},s={:d}}}\n", uniform(random, 1, 4000),
+                       uniform(random, 1, 4000), uniform(random, 1, 4000), uniform(random, 1, 4000));
+    } //for ( std::int64_t piece = 0; piece < 200 * scale; ++piece )
+    return;
+}
+
+void generate20(Random& random, std::int64_t scale, std::string& out) {
+    //Jede Kette ist ein Binärzähler, dessen Konjunktion bei einer Zahl n feuert. Teil 2 ist das kgV aller n, das muss
+    //in 64 Bit passen.
+    const auto chains       = std::min<std::int64_t>(4 * scale, 31);
+    const auto bits         = std::min<std::int64_t>(12, 62 / chains);
+    auto       cycleLengths = primesBetween((std::int64_t{1} << (bits - 1)) + 1, (std::int64_t{1} << bits) - 1);
+    std::ranges::shuffle(cycleLengths, random);
+
+    NameGenerator names{lowerCase, 2, 2};
+    names.reserve("rx");
+
+    std::vector<std::string> modules;
+    std::vector<std::string> chainStarts;
+    const auto               final = names(random);
+
+    for ( std::int64_t chain = 0; chain < chains; ++chain ) {
+        auto cycleLength = chain < static_cast<std::int64_t>(cycleLengths.size())
+                             ? cycleLengths[static_cast<std::size_t>(chain)]
+                             : uniform(random, std::int64_t{1} << (bits - 1), (std::int64_t{1} << bits) - 1) | 1;
+
+        std::vector<std::string> flipFlops(static_cast<std::size_t>(bits));
+        std::ranges::generate(flipFlops, [&names, &random](void) { return names(random); });
+        const auto conjunction = names(random);
+        const auto inverter    = names(random);
+        chainStarts.push_back(flipFlops.front());
+
+        std::string conjunctionTargets;
+        for ( std::size_t bit = 0; bit < flipFlops.size(); ++bit ) {
+            std::string targets;
+            if ( bit + 1 < flipFlops.size() ) {
+                targets = flipFlops[bit + 1];
+            } //if ( bit + 1 < flipFlops.size() )
+
+            if ( (cycleLength >> bit) & 1 ) {
+                targets += targets.empty() ? "" : ", ";
+                targets += conjunction;
+            } //if ( (cycleLength >> bit) & 1 )
+            if ( bit == 0 || !((cycleLength >> bit) & 1) ) {
+                conjunctionTargets += std::format("{:s}, ", flipFlops[bit]);
+            } //if ( bit == 0 || !((cycleLength >> bit) & 1) )
+            modules.push_back(std::format("%{:s} -> {:s}", flipFlops[bit], targets));
+        } //for ( std::size_t bit = 0; bit < flipFlops.size(); ++bit )
+
+        modules.push_back(std::format("&{:s} -> {:s}{:s}", conjunction, conjunctionTargets, inverter));
+        modules.push_back(std::format("&{:s} -> {:s}", inverter, final));
+    } //for ( std::int64_t chain = 0; chain < chains; ++chain )
+
+    modules.push_back(std::format("&{:s} -> rx", final));
+    std::string broadcaster = "broadcaster -> ";
+    for ( std::size_t i = 0; i < chainStarts.size(); ++i ) {
+        std::format_to(std::back_inserter(broadcaster), "{:s}{:s}", i == 0 ? "" : ", ", chainStarts[i]);
+    } //for ( std::size_t i = 0; i < chainStarts.size(); ++i )
+    modules.push_back(std::move(broadcaster));
+
+    std::ranges::shuffle(modules, random);
+    for ( const auto& module : modules ) {
+        out += module;
+        out += '\n';
+    } //for ( const auto& module : modules )
+    return;
+}
+
+void generate21(Random& random, std::int64_t scale, std::string& out) {
+    //Die Extrapolation über 26501365 Schritte ist nur für Größen exakt, die 2 * 26501365 + 1 teilen. Das sind 131
+    //und 393 (und dann erst wieder 134867).
+    const auto size   = scale == 1 ? 131 : 393;
+    const auto center = size / 2;
+    auto       grid   = randomGrid(random, static_cast<std::size_t>(size), static_cast<std::size_t>(size),
+                                   "......#"sv);
+
+    for ( int row = 0; row < size; ++row ) {
+        for ( int column = 0; column < size; ++column ) {
+            const auto distance = std::abs(row - center) + std::abs(column - center);
+            //Mittelkreuz, Rand und die Raute müssen frei sein, sonst stimmt die Extrapolation nicht.
+            if ( row == center || column == center || row == 0 || column == 0 || row == size - 1 ||
+                 column == size - 1 || std::abs(distance - center) <= 1 ) {
+                grid[static_cast<std::size_t>(row)][static_cast<std::size_t>(column)] = '.';
+            } //if ( row == center || ... )
+        } //for ( int column = 0; column < size; ++column )
+    } //for ( int row = 0; row < size; ++row )
+    grid[static_cast<std::size_t>(center)][static_cast<std::size_t>(center)] = 'S';
+
+    appendGrid(grid, out);
+    return;
+}
+
+void generate22(Random& random, std::int64_t scale, std::string& out) {
+    //Der Löser hat einen festen 10x10x350 Turm, mehr als eine gewisse Dichte geht nicht.
+    constexpr auto levels         = 340;
+    const auto     numberOfBricks = std::min<std::int64_t>(1200 * scale, 9000);
+    std::vector<std::array<std::array<bool, 10>, 10>> occupied(levels + 1);
+
+    std::int64_t placed = 0;
+    for ( std::int64_t attempt = 0; placed < numberOfBricks && attempt < 100 * numberOfBricks; ++attempt ) {
+        std::array<std::int64_t, 3> start{uniform(random, 0, 9), uniform(random, 0, 9), uniform(random, 1, levels)};
+        auto                        end    = start;
+        const auto                  axis   = uniformIndex(random, 3);
+        end[axis]                         += uniform(random, 0, 4);
+        if ( end[axis] > (axis == 2 ? levels : 9) ) {
+            continue;
+        } //if ( end[axis] > (axis == 2 ? levels : 9) )
+
+        auto cells = [&](auto function) {
+            for ( auto x = start[0]; x <= end[0]; ++x ) {
+                for ( auto y = start[1]; y <= end[1]; ++y ) {
+                    for ( auto z = start[2]; z <= end[2]; ++z ) {
+                        function(occupied[static_cast<std::size_t>(z)][static_cast<std::size_t>(x)]
+                                         [static_cast<std::size_t>(y)]);
+                    } //for ( auto z = start[2]; z <= end[2]; ++z )
+                } //for ( auto y = start[1]; y <= end[1]; ++y )
+            } //for ( auto x = start[0]; x <= end[0]; ++x )
+            return;
+        };
+
+        bool free = true;
+        cells([&free](bool cell) noexcept { free = free && !cell; });
+        if ( !free ) {
+            continue;
+        } //if ( !free )
+        cells([](bool& cell) noexcept { cell = true; });
+
+        std::format_to(std::back_inserter(out), "{:d},{:d},{:d}~{:d},{:d},{:d}\n", start[0], start[1], start[2],
+                       end[0], end[1], end[2]);
+        ++placed;
+    } //for ( std::int64_t attempt = 0; placed < numberOfBricks && attempt < 100 * numberOfBricks; ++attempt )
+    return;
+}
+
+void generate23(Random& random, std::int64_t scale, std::string& out) {
+    //6x6 Kreuzungen wie im Original, mehr macht Teil 2 (längster Pfad) unlösbar. Skaliert werden die Gänge.
+    constexpr auto             crossings = 6uz;
+    std::array<std::size_t, 6> rows;
+    std::array<std::size_t, 6> columns;
+
+    auto spacing = [&random, scale](void) { return static_cast<std::size_t>(uniform(random, 15, 25) * scale); };
+    rows[0]      = spacing();
+    columns[0]   = spacing();
+    for ( std::size_t i = 1; i < crossings; ++i ) {
+        rows[i]    = rows[i - 1] + spacing();
+        columns[i] = columns[i - 1] + spacing();
+    } //for ( std::size_t i = 1; i < crossings; ++i )
+
+    const auto height = rows.back() + spacing() + 1;
+    const auto width  = columns.back() + spacing() + 1;
+    std::vector<std::string> grid(height, std::string(width, '#'));
+
+    auto corridor = [&grid](std::size_t row, std::size_t column, std::size_t rowStep, std::size_t columnStep,
+                            std::size_t length, char slope) {
+        for ( std::size_t i = 1; i < length; ++i ) {
+            grid[row + i * rowStep][column + i * columnStep] = i == 1 || i + 1 == length ? slope : '.';
+        } //for ( std::size_t i = 1; i < length; ++i )
+        return;
+    };
+
+    for ( std::size_t r = 0; r < crossings; ++r ) {
+        for ( std::size_t c = 0; c < crossings; ++c ) {
+            grid[rows[r]][columns[c]] = '.';
+            if ( c + 1 < crossings ) {
+                corridor(rows[r], columns[c], 0, 1, columns[c + 1] - columns[c], '>');
+            } //if ( c + 1 < crossings )
+            if ( r + 1 < crossings ) {
+                corridor(rows[r], columns[c], 1, 0, rows[r + 1] - rows[r], 'v');
+            } //if ( r + 1 < crossings )
+        } //for ( std::size_t c = 0; c < crossings; ++c )
+    } //for ( std::size_t r = 0; r < crossings; ++r )
+
+    //Start und Ziel, jeweils ohne Gefälle am Rand.
+    for ( std::size_t row = 0; row < rows.front(); ++row ) {
+        grid[row][columns.front()] = row + 1 == rows.front() ? 'v' : '.';
+    } //for ( std::size_t row = 0; row < rows.front(); ++row )
+    for ( std::size_t row = rows.back() + 1; row < height; ++row ) {
+        grid[row][columns.back()] = row == rows.back() + 1 ? 'v' : '.';
+    } //for ( std::size_t row = rows.back() + 1; row < height; ++row )
+
+    appendGrid(grid, out);
+    return;
+}
+
+void generate24(Random& random, std::int64_t scale, std::string& out) {
+    //Alle Hagelkörner liegen auf der Bahn eines Steins, damit Teil 2 eine Lösung hat.
+    std::array<std::int64_t, 3> rockPosition;
+    std::array<std::int64_t, 3> rockVelocity;
+    for ( std::size_t axis = 0; axis < 3; ++axis ) {
+        rockPosition[axis] = uniform(random, 150'000'000'000'000, 350'000'000'000'000);
+        rockVelocity[axis] = uniform(random, -300, 300);
+    } //for ( std::size_t axis = 0; axis < 3; ++axis )
+
+    std::unordered_set<std::int64_t> usedTimes;
+    for ( std::int64_t hail = 0; hail < 300 * scale; ) {
+        const auto time = uniform(random, 100'000'000'000, 1'000'000'000'000);
+        if ( usedTimes.contains(time) ) {
+            continue;
+        } //if ( usedTimes.contains(time) )
+
+        std::array<std::int64_t, 3> position;
+        std::array<std::int64_t, 3> velocity;
+        bool                        valid = true;
+        for ( std::size_t axis = 0; axis < 3; ++axis ) {
+            velocity[axis] = uniform(random, -500, 500);
+            position[axis] = rockPosition[axis] + time * (rockVelocity[axis] - velocity[axis]);
+            //Der Löser liest nur positive Positionen.
+            valid          = valid && velocity[axis] != rockVelocity[axis] && position[axis] >= 0;
+        } //for ( std::size_t axis = 0; axis < 3; ++axis )
+        if ( !valid ) {
+            continue;
+        } //if ( !valid )
+
+        usedTimes.insert(time);
+        std::format_to(std::back_inserter(out), "{:d}, {:d}, {:d} @ {:d}, {:d}, {:d}\n", position[0], position[1],
+                       position[2], velocity[0], velocity[1], velocity[2]);
+        ++hail;
+    } //for ( std::int64_t hail = 0; hail < 300 * scale; )
+    return;
+}
+
+void generate25(Random& random, std::int64_t scale, std::string& out) {
+    //Zwei Gruppen mit mindestens Grad 4, verbunden durch genau 3 Kanten.
+    const auto    numberOfNodes = static_cast<std::size_t>(std::min<std::int64_t>(1500 * scale, 17'000));
+    NameGenerator nameGenerator{lowerCase, 3, 3};
+    std::vector<std::string> names(numberOfNodes);
+    std::ranges::generate(names, [&nameGenerator, &random](void) { return nameGenerator(random); });
+
+    const auto firstGroupSize =
+        static_cast<std::size_t>(uniform(random, static_cast<std::int64_t>(numberOfNodes * 2 / 5),
+                                         static_cast<std::int64_t>(numberOfNodes * 3 / 5)));
+    std::vector<std::unordered_set<std::size_t>> edges(numberOfNodes);
+    std::vector<std::size_t>                     degree(numberOfNodes, 0);
+
+    auto connect = [&edges, &degree](std::size_t a, std::size_t b) {
+        if ( a == b || edges[a].contains(b) || edges[b].contains(a) ) {
+            return;
+        } //if ( a == b || edges[a].contains(b) || edges[b].contains(a) )
+        edges[a].insert(b);
+        ++degree[a];
+        ++degree[b];
+        return;
+    };
+
+    for ( std::size_t node = 0; node < numberOfNodes; ++node ) {
+        const bool firstGroup = node < firstGroupSize;
+        const auto groupBegin = firstGroup ? 0 : firstGroupSize;
+        const auto groupSize  = firstGroup ? firstGroupSize : numberOfNodes - firstGroupSize;
+        while ( degree[node] < 4 ) {
+            connect(node, groupBegin + uniformIndex(random, groupSize));
+        } //while ( degree[node] < 4 )
+    } //for ( std::size_t node = 0; node < numberOfNodes; ++node )
+
+    for ( int cut = 0; cut < 3; ) {
+        const auto a = uniformIndex(random, firstGroupSize);
+        const auto b = firstGroupSize + uniformIndex(random, numberOfNodes - firstGroupSize);
+        if ( !edges[a].contains(b) ) {
+            connect(a, b);
+            ++cut;
+        } //if ( !edges[a].contains(b) )
+    } //for ( int cut = 0; cut < 3; )
+
+    std::vector<std::size_t> order(numberOfNodes);
+    std::iota(order.begin(), order.end(), 0uz);
+    std::ranges::shuffle(order, random);
+    for ( auto node : order ) {
+        if ( edges[node].empty() ) {
+            continue;
+        } //if ( edges[node].empty() )
+        std::format_to(std::back_inserter(out), "{:s}:", names[node]);
+        for ( auto other : edges[node] ) {
+            std::format_to(std::back_inserter(out), " {:s}", names[other]);
+        } //for ( auto other : edges[node] )
+        out += '\n';
+    } //for ( auto node : order )
+    return;
+}
+} //namespace
+
+Generator findGenerator(std::int64_t challenge) noexcept {
+    static constexpr std::array generators{
+        generate1,  generate2,  generate3,  generate4,  generate5,  generate6,  generate7,  generate8,  generate9,
+        generate10, generate11, generate12, generate13, generate14, generate15, generate16, generate17, generate18,
+        generate19, generate20, generate21, generate22, generate23, generate24, generate25,
+    };
+
+    if ( challenge < 1 || challenge > static_cast<std::int64_t>(generators.size()) ) {
+        return nullptr;
+    } //if ( challenge < 1 || challenge > static_cast<std::int64_t>(generators.size()) )
+    return generators[static_cast<std::size_t>(challenge - 1)];
+}
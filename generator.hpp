@@ -0,0 +1,24 @@
+#ifndef GENERATOR_HPP
+#define GENERATOR_HPP
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+using Random = std::mt19937_64;
+
+/**
+ * @brief Erzeugt eine gültige Eingabe für eine Challenge und hängt sie an out an.
+ *
+ * Bei scale 1 entspricht die Größe ungefähr der echten Eingabe, größere Werte vergrößern die Eingabe entsprechend,
+ * soweit der Löser das zulässt.
+ */
+using Generator = void (*)(Random& random, std::int64_t scale, std::string& out);
+
+/**
+ * @brief Sucht den Generator für die Challenge.
+ * @return Den Generator oder nullptr, wenn es die Challenge nicht gibt.
+ */
+Generator findGenerator(std::int64_t challenge) noexcept;
+
+#endif //GENERATOR_HPP
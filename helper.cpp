@@ -2,12 +2,44 @@
 
 #include "print.hpp"
 
+#include <format>
 #include <stdexcept>
+#include <string_view>
 
-void throwIfInvalid(bool valid, const char* msg) {
-    if ( !valid ) {
-        myFlush();
-        throw std::runtime_error{msg};
-    } //if ( !valid )
+void throwInvalid(const char* msg, const std::source_location& where) {
+    myFlush();
+    std::string_view file = where.file_name();
+    if ( const auto slash = file.find_last_of("/\\"); slash != std::string_view::npos ) {
+        file.remove_prefix(slash + 1);
+    } //if ( const auto slash = file.find_last_of("/\\"); slash != std::string_view::npos )
+    throw std::runtime_error{std::format("{:s} ({:s}:{:d})", msg, file, where.line())};
+}
+
+IntegerTable::IntegerTable(const std::vector<std::string_view>& lines, std::string_view rowSeparators) {
+    //Jede Zahl braucht mindestens eine Ziffer und danach einen Trenner, mehr als die Hälfte der Zeichen geht nicht.
+    std::size_t maxValues = 0;
+    for ( auto line : lines ) {
+        maxValues += (line.size() + 1) / 2;
+    } //for ( auto line : lines )
+
+    Values.resize(maxValues);
+    RowOffsets.reserve(lines.size() + 1);
+
+    auto out = Values.data();
+    for ( auto line : lines ) {
+        for ( std::size_t begin = 0;; ) {
+            const auto end  = line.find_first_of(rowSeparators, begin);
+            out            += parseIntegers(line.substr(begin, end - begin), out);
+            RowOffsets.push_back(static_cast<std::size_t>(out - Values.data()));
+
+            if ( end == std::string_view::npos ) {
+                break;
+            } //if ( end == std::string_view::npos )
+            begin = end + 1;
+        } //for ( std::size_t begin = 0;; )
+    } //for ( auto line : lines )
+
+    //Verkleinern gibt den Speicher nicht frei, es bleibt bei der einen Allokation.
+    Values.resize(RowOffsets.back());
     return;
 }
@@ -1,32 +1,243 @@
 #ifndef HELPER_HPP
 #define HELPER_HPP
 
+#include <bit>
 #include <charconv>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <optional>
 #include <ranges>
+#include <source_location>
+#include <span>
 #include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+constexpr bool isDigit(char c) noexcept {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+/**
+ * @brief Findet alle Vorkommen eines Trennzeichens, immer 32 Bytes am Stück.
+ *
+ * Mit AVX2 ist ein Block ein Vergleich, mit SSE2 zwei, sonst (und zur Compilezeit) wird skalar gesucht. Die Treffer
+ * eines Blocks liegen als Bitmaske vor, so dass kurze Tokens nicht jedes Mal einen neuen Vergleich brauchen.
+ */
+class DelimiterScanner {
+    public:
+    static constexpr std::size_t npos = std::string_view::npos;
+
+    constexpr DelimiterScanner(void) noexcept = default;
+
+    constexpr DelimiterScanner(std::string_view data, char delimiter) noexcept :
+            Data{data.data()}, Size{data.size()}, Delimiter{delimiter} {
+        Mask = Size == 0 ? 0 : blockMask(0);
+        return;
+    }
+
+    /**
+     * @return Die Position des nächsten Trennzeichens oder npos.
+     */
+    constexpr std::size_t next(void) noexcept {
+        while ( Mask == 0 ) {
+            BlockStart += BlockSize;
+            if ( BlockStart >= Size ) {
+                BlockStart = Size;
+                return npos;
+            } //if ( BlockStart >= Size )
+            Mask = blockMask(BlockStart);
+        } //while ( Mask == 0 )
+
+        const auto ret  = BlockStart + static_cast<std::size_t>(std::countr_zero(Mask));
+        Mask           &= Mask - 1;
+        return ret;
+    }
+
+    private:
+    static constexpr std::size_t BlockSize = 32;
+
+    const char*   Data       = nullptr;
+    std::size_t   Size       = 0;
+    std::size_t   BlockStart = 0;
+    std::uint32_t Mask       = 0;
+    char          Delimiter  = '\0';
+
+    constexpr std::uint32_t blockMask(std::size_t start) const noexcept {
+        const auto block = Data + start;
+
+        if !consteval {
+            if ( Size - start >= BlockSize ) {
+#if defined(__AVX2__)
+                const auto needle = _mm256_set1_epi8(Delimiter);
+                const auto bytes  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle)));
+#elif defined(__SSE2__)
+                const auto needle = _mm_set1_epi8(Delimiter);
+                const auto low    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                const auto high   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(low, needle))) |
+                       static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(high, needle))) << 16;
+#endif
+            } //if ( Size - start >= BlockSize )
+        } //if !consteval
+
+        //Der Rest am Ende, oder ganz ohne SIMD.
+        std::uint32_t ret = 0;
+        for ( std::size_t i = 0; i < BlockSize && start + i < Size; ++i ) {
+            ret |= static_cast<std::uint32_t>(block[i] == Delimiter) << i;
+        } //for ( std::size_t i = 0; i < BlockSize && start + i < Size; ++i )
+        return ret;
+    }
+};
+
+/**
+ * @brief Die Teile zwischen den Trennzeichen, wie std::views::split, aber mit dem DelimiterScanner.
+ * @tparam SkipEmpty Ob leere Teile übersprungen werden.
+ */
+template<bool SkipEmpty>
+class SplitView : public std::ranges::view_interface<SplitView<SkipEmpty>> {
+    public:
+    class Iterator {
+        public:
+        using value_type       = std::string_view;
+        using difference_type  = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr Iterator(void) noexcept = default;
+
+        constexpr Iterator(std::string_view data, char delimiter) noexcept :
+                Data{data}, Scanner{data, delimiter}, AtEnd{data.empty()} {
+            if ( !AtEnd ) {
+                advance();
+            } //if ( !AtEnd )
+            return;
+        }
+
+        constexpr std::string_view operator*(void) const noexcept {
+            return Current;
+        }
+
+        constexpr Iterator& operator++(void) noexcept {
+            advance();
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            auto ret = *this;
+            advance();
+            return ret;
+        }
+
+        constexpr bool operator==(const Iterator& that) const noexcept {
+            return AtEnd == that.AtEnd && (AtEnd || Current.data() == that.Current.data());
+        }
+
+        constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return AtEnd;
+        }
+
+        private:
+        std::string_view Data;
+        std::string_view Current;
+        DelimiterScanner Scanner;
+        std::size_t      Begin   = 0;
+        bool             HasMore = true;
+        bool             AtEnd   = true;
+
+        constexpr void advance(void) noexcept {
+            do {
+                if ( !HasMore ) {
+                    AtEnd = true;
+                    return;
+                } //if ( !HasMore )
+
+                const auto end = Scanner.next();
+                if ( end == DelimiterScanner::npos ) {
+                    //Wie bei std::views::split gibt ein Trennzeichen am Ende noch einen leeren Teil.
+                    Current = {Data.data() + Begin, Data.size() - Begin};
+                    HasMore = false;
+                } //if ( end == DelimiterScanner::npos )
+                else {
+                    Current = {Data.data() + Begin, end - Begin};
+                    Begin   = end + 1;
+                } //else -> if ( end == DelimiterScanner::npos )
+            } while ( SkipEmpty && Current.empty() );
+            return;
+        }
+    };
+
+    constexpr SplitView(void) noexcept = default;
+
+    constexpr SplitView(std::string_view data, char delimiter) noexcept : Data{data}, Delimiter{delimiter} {
+        return;
+    }
+
+    constexpr Iterator begin(void) const noexcept {
+        return {Data, Delimiter};
+    }
+
+    constexpr std::default_sentinel_t end(void) const noexcept {
+        return std::default_sentinel;
+    }
+
+    private:
+    std::string_view Data;
+    char             Delimiter = '\0';
+};
+
+template<bool SkipEmpty>
+inline constexpr bool std::ranges::enable_borrowed_range<SplitView<SkipEmpty>> = true;
 
 template<bool SkipEmpty = true>
 constexpr auto splitString(const std::string_view data, const char delimiter) noexcept {
-    auto split = data | std::views::split(delimiter) | std::views::transform([](const auto& subRange) noexcept {
-                     return std::string_view{&*subRange.begin(), std::ranges::size(subRange)};
-                 });
-    if constexpr ( SkipEmpty ) {
-        return split | std::views::filter([](const std::string_view entry) noexcept { return !entry.empty(); });
-    } //if constexpr ( SkipEmpty )
-    else {
-        return split;
-    } //else -> if constexpr ( SkipEmpty )
+    return SplitView<SkipEmpty>{data, delimiter};
+}
+
+/**
+ * @brief Wirft std::runtime_error mit msg und der Stelle der Prüfung. Liegt außerhalb, damit der Aufrufer klein bleibt.
+ */
+[[noreturn, gnu::cold]] void throwInvalid(const char* msg, const std::source_location& where);
+
+/**
+ * @brief Für die Prüfung der Eingabe, vor allem beim Parsen. Bleibt in jedem Build erhalten.
+ */
+inline void throwIfInvalid(bool valid, const char* msg = "Invalid Data",
+                           const std::source_location& where = std::source_location::current()) {
+    if ( !valid ) [[unlikely]] {
+        throwInvalid(msg, where);
+    } //if ( !valid )
+    return;
 }
 
-void throwIfInvalid(bool valid, const char* msg = "Invalid Data");
+#if defined(AOC_UNCHECKED)
+inline constexpr bool checkInvariants = false;
+#else
+inline constexpr bool checkInvariants = true;
+#endif
+
+/**
+ * @brief Für Prüfungen in heißen Schleifen, die bei gültiger Eingabe nie fehlschlagen.
+ *
+ * Normal wie throwIfInvalid, mit AOC_UNCHECKED (Release Build) entfällt die Prüfung komplett. Die Bedingung sollte
+ * daher keine Seiteneffekte haben.
+ */
+inline void checkInvariant(bool valid, const char* msg = "Invariant violated",
+                           const std::source_location& where = std::source_location::current()) {
+    if constexpr ( checkInvariants ) {
+        throwIfInvalid(valid, msg, where);
+    } //if constexpr ( checkInvariants )
+    return;
+}
 
 template<int Base = 10>
 inline std::optional<std::int64_t> convertOptionally(std::string_view input) {
-    if ( Base == 10 && !std::isdigit(input[0]) && input[0] != '-' ) {
+    if ( Base == 10 && !isDigit(input[0]) && input[0] != '-' ) {
         return std::nullopt;
-    } //if ( Base == 10 && !std::isdigit(input[0]) && input[0] != '-' )
+    } //if ( Base == 10 && !isDigit(input[0]) && input[0] != '-' )
 
     std::int64_t ret    = 0;
     auto         result = std::from_chars(input.begin(), input.end(), ret, Base);
@@ -41,6 +252,74 @@ inline std::int64_t convert(std::string_view input) {
     return *result;
 }
 
+/**
+ * @brief Liest alle Zahlen aus input in einem Durchgang, alles andere gilt als Trenner. Ein - direkt vor einer Zahl
+ * macht sie negativ, aber nur, wenn davor keine Ziffer steht: 3-5 sind die Zahlen 3 und 5, nicht 3 und -5.
+ * @return Die Anzahl der gelesenen Zahlen.
+ * @throw Wenn eine Zahl nicht in std::int64_t passt, die Eingabe kann von außen kommen (--batch, --serve).
+ */
+template<typename OutputIterator>
+constexpr std::size_t parseIntegers(std::string_view input, OutputIterator out) {
+    std::size_t ret = 0;
+    for ( std::size_t i = 0; i < input.size(); ) {
+        if ( !isDigit(input[i]) ) {
+            ++i;
+            continue;
+        } //if ( !isDigit(input[i]) )
+
+        const bool   negative = i > 0 && input[i - 1] == '-' && (i == 1 || !isDigit(input[i - 2]));
+        std::int64_t value    = 0;
+        bool         overflow = false;
+        for ( ; i < input.size() && isDigit(input[i]); ++i ) {
+            overflow |= __builtin_mul_overflow(value, 10, &value);
+            overflow |= __builtin_add_overflow(value, input[i] - '0', &value);
+        } //for ( ; i < input.size() && isDigit(input[i]); ++i )
+        if ( overflow ) [[unlikely]] {
+            throwInvalid("Integer out of range", std::source_location::current());
+        } //if ( overflow )
+        *out++ = negative ? -value : value;
+        ++ret;
+    } //for ( std::size_t i = 0; i < input.size(); )
+    return ret;
+}
+
+/**
+ * @brief Alle Zahlen einer Eingabe in einem zusammenhängenden Puffer, mit einem Abschnitt (Zeile) pro Eingabezeile.
+ *
+ * Gelesen wird in einem Durchgang mit parseIntegers, der Puffer wird vorher einmal in maximal möglicher Größe
+ * angelegt. Zeilen ohne Zahlen ergeben leere Zeilen, so bleiben die Indizes gleich denen der Eingabe.
+ */
+class IntegerTable {
+    public:
+    IntegerTable(void) noexcept = default;
+
+    /**
+     * @param[in] rowSeparators Zeichen, die innerhalb einer Eingabezeile zusätzlich eine neue Zeile beginnen.
+     */
+    explicit IntegerTable(const std::vector<std::string_view>& lines, std::string_view rowSeparators = {});
+
+    std::size_t rowCount(void) const noexcept {
+        return RowOffsets.size() - 1;
+    }
+
+    std::span<const std::int64_t> row(std::size_t index) const noexcept {
+        return {Values.data() + RowOffsets[index], Values.data() + RowOffsets[index + 1]};
+    }
+
+    auto rows(void) const noexcept {
+        return std::views::iota(0uz, rowCount()) |
+               std::views::transform([this](std::size_t index) noexcept { return row(index); });
+    }
+
+    std::span<const std::int64_t> values(void) const noexcept {
+        return Values;
+    }
+
+    private:
+    std::vector<std::int64_t> Values;
+    std::vector<std::size_t>  RowOffsets{0};
+};
+
 inline double convertDouble(std::string_view input) {
     double ret    = 0.;
     auto   result = std::from_chars(input.begin(), input.end(), ret);
@@ -0,0 +1,151 @@
+#include "input.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+struct FileDescriptor {
+    int Fd;
+
+    ~FileDescriptor(void) {
+        if ( Fd >= 0 ) {
+            ::close(Fd);
+        } //if ( Fd >= 0 )
+        return;
+    }
+};
+
+[[noreturn]] void throwErrno(std::string_view what, const std::filesystem::path& path) {
+    throw std::runtime_error{std::format("{:s} \"{:s}\": {:s}", what, path.c_str(), std::strerror(errno))};
+}
+} //namespace
+
+InputFile InputFile::load(const std::filesystem::path& path) {
+    if ( !std::filesystem::exists(path) ) {
+        throw std::runtime_error{std::format("\"{:s}\" does not exist!", path.c_str())};
+    } //if ( !std::filesystem::exists(path) )
+
+    if ( std::filesystem::is_directory(path) ) {
+        throw std::runtime_error{std::format("\"{:s}\" is not a file!", path.c_str())};
+    } //if ( std::filesystem::is_directory(path) )
+
+    const FileDescriptor file{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if ( file.Fd < 0 ) {
+        throwErrno("Could not open", path);
+    } //if ( file.Fd < 0 )
+
+    struct stat status;
+    if ( ::fstat(file.Fd, &status) != 0 ) {
+        throwErrno("Could not stat", path);
+    } //if ( ::fstat(file.Fd, &status) != 0 )
+
+    if ( !S_ISREG(status.st_mode) ) {
+        //Pipes und Co. kann man nicht mappen.
+        return readAll(file.Fd, path);
+    } //if ( !S_ISREG(status.st_mode) )
+
+    InputFile ret;
+    ret.MappingSize = static_cast<std::size_t>(status.st_size);
+    if ( ret.MappingSize != 0 ) {
+        auto mapping = ::mmap(nullptr, ret.MappingSize, PROT_READ, MAP_PRIVATE, file.Fd, 0);
+        if ( mapping == MAP_FAILED ) {
+            //Manche Dateisysteme können kein mmap, dann halt klassisch.
+            return readAll(file.Fd, path);
+        } //if ( mapping == MAP_FAILED )
+        ret.Mapping = mapping;
+        ::madvise(ret.Mapping, ret.MappingSize, MADV_SEQUENTIAL);
+    } //if ( ret.MappingSize != 0 )
+    ret.buildLines();
+    return ret;
+}
+
+InputFile InputFile::loadStdin(void) {
+    return readAll(STDIN_FILENO, "<stdin>");
+}
+
+InputFile InputFile::fromBuffer(std::vector<char> buffer) {
+    InputFile ret;
+    ret.Buffer = std::move(buffer);
+    ret.buildLines();
+    return ret;
+}
+
+InputFile InputFile::readAll(int fd, const std::filesystem::path& path) {
+    InputFile      ret;
+    constexpr auto chunkSize = 64uz * 1024;
+    std::size_t    used      = 0;
+
+    for ( ;; ) {
+        ret.Buffer.resize(used + chunkSize);
+        const auto bytesRead = ::read(fd, ret.Buffer.data() + used, chunkSize);
+        if ( bytesRead < 0 ) {
+            if ( errno == EINTR ) {
+                continue;
+            } //if ( errno == EINTR )
+            throwErrno("Could not read", path);
+        } //if ( bytesRead < 0 )
+
+        if ( bytesRead == 0 ) {
+            break;
+        } //if ( bytesRead == 0 )
+        used += static_cast<std::size_t>(bytesRead);
+    } //for ( ;; )
+
+    ret.Buffer.resize(used);
+    ret.buildLines();
+    return ret;
+}
+
+InputFile::InputFile(InputFile&& that) noexcept :
+        Mapping{std::exchange(that.Mapping, nullptr)}, MappingSize{std::exchange(that.MappingSize, 0)},
+        Buffer{std::move(that.Buffer)}, Lines{std::move(that.Lines)} {
+    return;
+}
+
+InputFile& InputFile::operator=(InputFile&& that) noexcept {
+    if ( this != &that ) {
+        unmap();
+        Mapping     = std::exchange(that.Mapping, nullptr);
+        MappingSize = std::exchange(that.MappingSize, 0);
+        Buffer      = std::move(that.Buffer);
+        Lines       = std::move(that.Lines);
+    } //if ( this != &that )
+    return *this;
+}
+
+InputFile::~InputFile(void) {
+    unmap();
+    return;
+}
+
+void InputFile::buildLines(void) {
+    const auto data = content();
+    Lines.reserve(static_cast<std::size_t>(std::ranges::count(data, '\n')) + 1);
+    std::ranges::copy(splitString<false>(data, '\n'), std::back_inserter(Lines));
+    auto lastNonEmpty = std::ranges::find_last_if_not(Lines, &std::string_view::empty);
+    if ( lastNonEmpty.begin() != Lines.end() ) {
+        Lines.erase(std::next(lastNonEmpty.begin()), lastNonEmpty.end());
+    } //if ( lastNonEmpty.begin() != Lines.end() )
+    return;
+}
+
+void InputFile::unmap(void) noexcept {
+    if ( Mapping ) {
+        ::munmap(Mapping, MappingSize);
+        Mapping     = nullptr;
+        MappingSize = 0;
+    } //if ( Mapping )
+    return;
+}
@@ -0,0 +1,60 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Die Eingabe einer Challenge, die Zeilen zeigen direkt in die Datei.
+ *
+ * Reguläre Dateien werden read-only gemappt, alles andere (Pipes, stdin) wird gepuffert eingelesen.
+ */
+class InputFile {
+    public:
+    /**
+     * @brief Lädt die Datei, wirft eine Exception, wenn das nicht geht.
+     */
+    static InputFile load(const std::filesystem::path& path);
+
+    /**
+     * @brief Liest die komplette Standardeingabe.
+     */
+    static InputFile loadStdin(void);
+
+    /**
+     * @brief Übernimmt eine bereits gelesene Eingabe, z.B. aus einem Socket.
+     */
+    static InputFile fromBuffer(std::vector<char> buffer);
+
+    InputFile(InputFile&& that) noexcept;
+    InputFile& operator=(InputFile&& that) noexcept;
+    ~InputFile(void);
+
+    InputFile(const InputFile&)            = delete;
+    InputFile& operator=(const InputFile&) = delete;
+
+    const std::vector<std::string_view>& lines(void) const noexcept {
+        return Lines;
+    }
+
+    std::string_view content(void) const noexcept {
+        return Mapping ? std::string_view{static_cast<const char*>(Mapping), MappingSize}
+                       : std::string_view{Buffer.data(), Buffer.size()};
+    }
+
+    private:
+    void*                         Mapping     = nullptr;
+    std::size_t                   MappingSize = 0;
+    std::vector<char>             Buffer;
+    std::vector<std::string_view> Lines;
+
+    InputFile(void) noexcept = default;
+
+    static InputFile readAll(int fd, const std::filesystem::path& path);
+    void             buildLines(void);
+    void             unmap(void) noexcept;
+};
+
+#endif //INPUT_HPP
@@ -1,45 +1,596 @@
-#include "challenge1.hpp"
-#include "challenge10.hpp"
-#include "challenge11.hpp"
-#include "challenge12.hpp"
-#include "challenge13.hpp"
-#include "challenge14.hpp"
-#include "challenge15.hpp"
-#include "challenge16.hpp"
+#include "allocation.hpp"
+#include "answers.hpp"
+#include "batch.hpp"
+#include "benchmark.hpp"
 #include "challenge17.hpp"
-#include "challenge18.hpp"
-#include "challenge19.hpp"
-#include "challenge2.hpp"
-#include "challenge20.hpp"
-#include "challenge21.hpp"
-#include "challenge22.hpp"
-#include "challenge23.hpp"
-#include "challenge24.hpp"
-#include "challenge25.hpp"
-#include "challenge3.hpp"
-#include "challenge4.hpp"
-#include "challenge5.hpp"
-#include "challenge6.hpp"
-#include "challenge7.hpp"
-#include "challenge8.hpp"
-#include "challenge9.hpp"
 #include "helper.hpp"
+#include "input.hpp"
+#include "perf.hpp"
 #include "print.hpp"
+#include "registry.hpp"
+#include "server.hpp"
+#include "threadpool.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstring>
 #include <exception>
 #include <filesystem>
 #include <format>
-#include <fstream>
-#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <ranges>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 using namespace std::string_view_literals;
 
+namespace {
+using Clock      = std::chrono::system_clock;
+using BenchClock = std::chrono::steady_clock;
+
+std::int64_t toNumber(std::string_view text) noexcept {
+    try {
+        return convert(text);
+    } //try
+    catch ( ... ) {
+        return 0;
+    }
+}
+
+struct Options {
+    std::size_t           Jobs      = 1;
+    bool                  Bench     = false;
+    std::int64_t          Repeat    = 10;
+    std::int64_t          Warmup    = 1;
+    //! 0 für beide Teile, sonst nur der angegebene.
+    int                   Part      = 0;
+    bool                  Perf      = false;
+    bool                  Allocs    = false;
+    //! Die erwarteten Ergebnisse ignorieren, für generierte Eingaben.
+    bool                  Reference = false;
+    bool                  Batch     = false;
+    //! Die Ergebnisse in das Manifest übernehmen.
+    bool                  Record    = false;
+    std::filesystem::path Report;
+    std::filesystem::path Answers;
+    //! Nicht leer heißt, als Server auf diesem Socket laufen.
+    std::filesystem::path Serve;
+    //! Nicht leer heißt, die Anfragen für Tiegel aus dieser Datei beantworten.
+    std::filesystem::path Crucibles;
+};
+
+struct ChallengeRun {
+    std::int64_t     Challenge  = 0;
+    bool             Run        = false;
+    bool             Successful = false;
+    //! Es gab für mindestens einen Teil kein erwartetes Ergebnis.
+    bool             Unverified = false;
+    std::uint64_t    InputHash  = 0;
+    Answers          Results;
+    OutputBuffer     Output;
+    std::atomic_bool Done{false};
+};
+
+/**
+ * @brief Die Datei, aus der die Eingabe der Challenge kommt.
+ * @return Leer, wenn sie von stdin gelesen wird.
+ */
+std::filesystem::path inputPath(const std::filesystem::path& dataDirectory, std::int64_t challenge) {
+    if ( dataDirectory == "-" ) {
+        return {};
+    } //if ( dataDirectory == "-" )
+    return dataDirectory / std::format("{:d}.txt", challenge);
+}
+
+InputFile loadInput(const std::filesystem::path& dataDirectory, std::int64_t challenge) {
+    if ( dataDirectory == "-" ) {
+        return InputFile::loadStdin();
+    } //if ( dataDirectory == "-" )
+    return InputFile::load(inputPath(dataDirectory, challenge));
+}
+
+/**
+ * @brief Der Hash der mitgelieferten data/N.txt, zu der die in der Challenge hinterlegten Ergebnisse gehören.
+ *
+ * Jede Datei wird nur beim ersten Aufruf gehasht, auch wenn die Challenges parallel laufen. Ist die geladene Eingabe
+ * diese Datei, wird ihr Hash übernommen, statt die Datei ein zweites Mal zu lesen.
+ * @param[in] loadedPath Woher die Eingabe kommt, leer für stdin.
+ * @param[in] loadedHash Der Hash der geladenen Eingabe.
+ * @return nullopt, wenn es die Datei nicht gibt.
+ */
+std::optional<std::uint64_t> shippedInputHash([[maybe_unused]] int                          challenge,
+                                              [[maybe_unused]] const std::filesystem::path& loadedPath,
+                                              [[maybe_unused]] std::uint64_t                loadedHash) noexcept {
+#ifdef AOC_DATA_DIRECTORY
+    constexpr std::size_t                                           challengeCount = 25;
+    static std::array<std::once_flag, challengeCount>               hashed;
+    static std::array<std::optional<std::uint64_t>, challengeCount> hashes;
+    if ( challenge < 1 || static_cast<std::size_t>(challenge) > challengeCount ) {
+        return std::nullopt;
+    } //if ( challenge < 1 || static_cast<std::size_t>(challenge) > challengeCount )
+
+    const auto index = static_cast<std::size_t>(challenge - 1);
+    try {
+        std::call_once(hashed[index], [challenge, &loadedPath, loadedHash, &hash = hashes[index]](void) {
+            const auto      path = std::filesystem::path{AOC_DATA_DIRECTORY} / std::format("{:d}.txt", challenge);
+            std::error_code error;
+            if ( !loadedPath.empty() && std::filesystem::equivalent(loadedPath, path, error) ) {
+                hash = loadedHash;
+            } //if ( !loadedPath.empty() && std::filesystem::equivalent(loadedPath, path, error) )
+            else if ( std::filesystem::is_regular_file(path) ) {
+                hash = hashInput(InputFile::load(path).content());
+            } //else if ( std::filesystem::is_regular_file(path) )
+            return;
+        });
+    } //try
+    catch ( ... ) {
+        //Dann wird es beim nächsten Aufruf wieder versucht.
+        return std::nullopt;
+    } //catch ( ... )
+    return hashes[index];
+#else
+    return std::nullopt;
+#endif
+}
+
+/**
+ * @brief Die erwarteten Ergebnisse für die Eingabe, nachgeschlagen über ihren Hash. Steht sie nicht im Manifest,
+ * gelten die in der Challenge hinterlegten nur, wenn sie inhaltlich die mitgelieferte data/N.txt ist. Für jede andere
+ * Eingabe, egal aus welchem Verzeichnis, wird nichts erwartet und die Ergebnisse bleiben ungeprüft.
+ */
+Answers expectedAnswers(const Challenge& challenge, std::uint64_t inputHash, const std::filesystem::path& inputPath,
+                        const AnswerManifest& manifest) {
+    if ( auto answers = manifest.find(inputHash); answers && answers->Challenge == challenge.Number ) {
+        return *answers;
+    } //if ( auto answers = manifest.find(inputHash); answers && answers->Challenge == challenge.Number )
+    if ( shippedInputHash(challenge.Number, inputPath, inputHash) != inputHash ) {
+        return {challenge.Number, std::nullopt, std::nullopt};
+    } //if ( shippedInputHash(challenge.Number, inputPath, inputHash) != inputHash )
+    return {challenge.Number, challenge.ExpectedPart1,
+            challenge.Part2 ? std::optional{challenge.ExpectedPart2} : std::nullopt};
+}
+
+bool isExpected(const std::optional<std::int64_t>& expected, std::int64_t result, const Options& options) noexcept {
+    return options.Reference || !expected || *expected == result;
+}
+
+void runChallenge(const std::filesystem::path& dataDirectory, const Options& options, const AnswerManifest& manifest,
+                  ChallengeRun& run) noexcept {
+    const auto challengeNumber = run.Challenge;
+    try {
+        const auto challenge = findChallenge(challengeNumber);
+        if ( !challenge ) {
+            myErr("Challenge {:d} is not known!\n", challengeNumber);
+            return;
+        } //if ( !challenge )
+
+        const auto input    = loadInput(dataDirectory, challengeNumber);
+        run.InputHash       = hashInput(input.content());
+        run.Results         = {challengeNumber, std::nullopt, std::nullopt};
+        const auto expected = expectedAnswers(*challenge, run.InputHash, inputPath(dataDirectory, challengeNumber),
+                                              manifest);
+
+        //Die Zähler müssen auf dem Thread geöffnet werden, auf dem die Challenge läuft.
+        std::optional<PerfCounters> perf;
+        if ( options.Perf ) {
+            perf.emplace();
+            if ( !perf->available() ) {
+                myErr("No performance counters available!\n");
+                perf.reset();
+            } //if ( !perf->available() )
+        } //if ( options.Perf )
+
+        //Gezählt werden nur die Stufen selbst, nicht die Ausgaben dazwischen.
+        AllocationStatistics                    allocations;
+        std::optional<ScopedAllocationTracking> allocationTracking;
+
+        const auto startCounters = [&options, &perf, &allocations, &allocationTracking](void) noexcept {
+            if ( options.Allocs ) {
+                allocationTracking.emplace(allocations);
+            } //if ( options.Allocs )
+            if ( perf ) {
+                perf->start();
+            } //if ( perf )
+            return;
+        };
+        const auto stopCounters = [&perf, &allocationTracking](void) noexcept {
+            std::optional<PerfCounts> ret;
+            if ( perf ) {
+                ret = perf->stop();
+            } //if ( perf )
+            allocationTracking.reset();
+            return ret;
+        };
+        const auto printCounters = [](const std::optional<PerfCounts>& counts) {
+            if ( counts ) {
+                myPrint("   {:s}\n", formatPerfCounts(*counts));
+            } //if ( counts )
+            return;
+        };
+
+        run.Run          = true;
+        myPrint(" == Starting Challenge {:d} ==\n", challengeNumber);
+        startCounters();
+        const auto start       = Clock::now();
+        const auto parsed      = challenge->Parse(input.lines());
+        const auto parseEnd    = Clock::now();
+        const auto parseCounts = stopCounters();
+        myPrint(" == Parsed after {} ==\n", std::chrono::duration_cast<std::chrono::microseconds>(parseEnd - start));
+        printCounters(parseCounts);
+
+        bool successful = true;
+        bool unverified = false;
+        auto runPart    = [&](int part, auto function, const std::optional<std::int64_t>& expectedResult) {
+            startCounters();
+            const auto partStart      = Clock::now();
+            const auto result         = function(parsed);
+            const auto partEnd        = Clock::now();
+            const auto counts         = stopCounters();
+            const bool unverifiedPart = !expectedResult && !options.Reference;
+            myPrint(" == Result of Part {:d}: {:d} (after {}{:s}) ==\n", part, result,
+                    std::chrono::duration_cast<std::chrono::microseconds>(partEnd - partStart),
+                    unverifiedPart ? ", unverified" : "");
+            printCounters(counts);
+            successful = isExpected(expectedResult, result, options) && successful;
+            unverified = unverifiedPart || unverified;
+            return result;
+        };
+
+        if ( options.Part != 2 ) {
+            run.Results.Part1 = runPart(1, challenge->Part1, expected.Part1);
+        } //if ( options.Part != 2 )
+        if ( options.Part != 1 && challenge->Part2 ) {
+            run.Results.Part2 = runPart(2, challenge->Part2, expected.Part2);
+        } //if ( options.Part != 1 && challenge->Part2 )
+
+        if ( !successful ) {
+            myPrint("Failed\n");
+        } //if ( !successful )
+        else if ( unverified ) {
+            run.Unverified = true;
+        } //else if ( unverified )
+        else {
+            run.Successful = true;
+        } //else -> if ( !successful )
+
+        if ( options.Allocs ) {
+            myPrint(" == Allocations: {:d} with {:d} bytes, peak {:d} bytes live ==\n", allocations.Allocations,
+                    allocations.Bytes, allocations.PeakLiveBytes);
+        } //if ( options.Allocs )
+
+        const auto end      = Clock::now();
+        const auto duration = end - start;
+        myPrint(" == End of Challenge {:d} after {} ==\n\n", challengeNumber,
+                std::chrono::duration_cast<std::chrono::milliseconds>(duration));
+    } //try
+    catch ( const std::exception& e ) {
+        run.Run = false;
+        myErr("Skipping Challenge {:d}: {:s}\n", challengeNumber, e.what());
+    } //catch ( const std::exception& e)
+    catch ( ... ) {
+        run.Run = false;
+        myErr("Skipping Challenge {:d}: Unknown exception\n", challengeNumber);
+    } //catch ( ... )
+    return;
+}
+
+/**
+ * @brief Verarbeitet die Optionen vor dem Datenverzeichnis und entfernt sie aus arguments.
+ * @return Die Optionen oder nullopt, wenn sie ungültig sind.
+ */
+std::optional<Options> parseOptions(std::span<const char*>& arguments) {
+    Options ret;
+
+    while ( !arguments.empty() && std::string_view{arguments.front()}.starts_with("--"sv) ) {
+        const std::string_view option{arguments.front()};
+        arguments = arguments.subspan(1);
+
+        auto nextArgument = [&arguments, option](void) -> std::optional<std::string_view> {
+            if ( arguments.empty() ) {
+                myErr("{:s} needs a value!\n", option);
+                return std::nullopt;
+            } //if ( arguments.empty() )
+            const std::string_view value{arguments.front()};
+            arguments = arguments.subspan(1);
+            return value;
+        };
+
+        auto nextNumber = [&nextArgument, option](std::int64_t minimum) -> std::optional<std::int64_t> {
+            auto value = nextArgument();
+            if ( !value ) {
+                return std::nullopt;
+            } //if ( !value )
+
+            const auto number = toNumber(*value);
+            if ( number < minimum || (number == 0 && *value != "0"sv) ) {
+                myErr("{:s} needs a number of at least {:d}!\n", option, minimum);
+                return std::nullopt;
+            } //if ( number < minimum || (number == 0 && *value != "0"sv) )
+            return number;
+        };
+
+        if ( option == "--jobs"sv ) {
+            const auto number = nextNumber(0);
+            if ( !number ) {
+                return std::nullopt;
+            } //if ( !number )
+            //0 heißt so viele wie es Kerne gibt.
+            ret.Jobs = *number == 0 ? std::thread::hardware_concurrency() : static_cast<std::size_t>(*number);
+        } //if ( option == "--jobs"sv )
+        else if ( option == "--batch"sv ) {
+            ret.Batch = true;
+        } //else if ( option == "--batch"sv )
+        else if ( option == "--crucibles"sv ) {
+            const auto path = nextArgument();
+            if ( !path ) {
+                return std::nullopt;
+            } //if ( !path )
+            ret.Crucibles = *path;
+        } //else if ( option == "--crucibles"sv )
+        else if ( option == "--bench"sv ) {
+            ret.Bench = true;
+        } //else if ( option == "--bench"sv )
+        else if ( option == "--repeat"sv ) {
+            const auto number = nextNumber(1);
+            if ( !number ) {
+                return std::nullopt;
+            } //if ( !number )
+            ret.Repeat = *number;
+        } //else if ( option == "--repeat"sv )
+        else if ( option == "--warmup"sv ) {
+            const auto number = nextNumber(0);
+            if ( !number ) {
+                return std::nullopt;
+            } //if ( !number )
+            ret.Warmup = *number;
+        } //else if ( option == "--warmup"sv )
+        else if ( option == "--answers"sv ) {
+            const auto path = nextArgument();
+            if ( !path ) {
+                return std::nullopt;
+            } //if ( !path )
+            ret.Answers = *path;
+        } //else if ( option == "--answers"sv )
+        else if ( option == "--allocs"sv ) {
+            ret.Allocs = true;
+        } //else if ( option == "--allocs"sv )
+        else if ( option == "--perf"sv ) {
+            ret.Perf = true;
+        } //else if ( option == "--perf"sv )
+        else if ( option == "--part"sv ) {
+            const auto number = nextNumber(1);
+            if ( !number || *number > 2 ) {
+                myErr("--part needs 1 or 2!\n");
+                return std::nullopt;
+            } //if ( !number || *number > 2 )
+            ret.Part = static_cast<int>(*number);
+        } //else if ( option == "--part"sv )
+        else if ( option == "--record"sv ) {
+            //Was den bekannten Ergebnissen widerspricht, wird nur zusammen mit --reference aufgezeichnet.
+            ret.Record = true;
+        } //else if ( option == "--record"sv )
+        else if ( option == "--serve"sv ) {
+            const auto path = nextArgument();
+            if ( !path ) {
+                return std::nullopt;
+            } //if ( !path )
+            ret.Serve = *path;
+        } //else if ( option == "--serve"sv )
+        else if ( option == "--reference"sv ) {
+            ret.Reference = true;
+        } //else if ( option == "--reference"sv )
+        else if ( option == "--report"sv ) {
+            const auto path = nextArgument();
+            if ( !path ) {
+                return std::nullopt;
+            } //if ( !path )
+            ret.Report = *path;
+        } //else if ( option == "--report"sv )
+        else {
+            myErr("Unknown option {:s}!\n", option);
+            return std::nullopt;
+        } //else -> if ( option == "--jobs"sv )
+    } //while ( !arguments.empty() && std::string_view{arguments.front()}.starts_with("--"sv) )
+
+    return ret;
+}
+
+/**
+ * @brief Führt die ausgewählten Teile ohne Ausgabe aus.
+ * @return Ob die Ergebnisse stimmen.
+ */
+bool runStages(const Challenge& challenge, const std::vector<std::string_view>& input, const Answers& expected,
+               const Options& options) {
+    const auto parsed     = challenge.Parse(input);
+    bool       successful = true;
+    if ( options.Part != 2 ) {
+        successful = isExpected(expected.Part1, challenge.Part1(parsed), options);
+    } //if ( options.Part != 2 )
+    if ( options.Part != 1 && challenge.Part2 ) {
+        successful = isExpected(expected.Part2, challenge.Part2(parsed), options) && successful;
+    } //if ( options.Part != 1 && challenge.Part2 )
+    return successful;
+}
+
+/**
+ * @brief Lässt eine Challenge mehrfach laufen und misst jeden Lauf einzeln. Die Ausgaben der Challenge werden
+ * verworfen.
+ */
+BenchmarkResult benchmarkChallenge(const std::filesystem::path& dataDirectory, std::int64_t challengeNumber,
+                                   const Options& options, const AnswerManifest& manifest) {
+    BenchmarkResult ret;
+    ret.Challenge        = challengeNumber;
+
+    const auto challenge = findChallenge(challengeNumber);
+    if ( !challenge ) {
+        throw std::runtime_error{std::format("Challenge {:d} is not known!", challengeNumber)};
+    } //if ( !challenge )
+
+    const auto                            input    = loadInput(dataDirectory, challengeNumber);
+    const auto                            expected =
+        expectedAnswers(*challenge, hashInput(input.content()), inputPath(dataDirectory, challengeNumber), manifest);
+    std::vector<std::chrono::nanoseconds> samples;
+    samples.reserve(static_cast<std::size_t>(options.Repeat));
+    ret.Successful = true;
+
+    {
+        OutputBuffer       discard{.Out = {}, .Err = {}, .Discard = true};
+        ScopedOutputBuffer scope{discard};
+
+        for ( std::int64_t i = 0; i < options.Warmup; ++i ) {
+            runStages(*challenge, input.lines(), expected, options);
+        } //for ( std::int64_t i = 0; i < options.Warmup; ++i )
+
+        for ( std::int64_t i = 0; i < options.Repeat; ++i ) {
+            const auto start      = BenchClock::now();
+            const bool successful = runStages(*challenge, input.lines(), expected, options);
+            const auto end        = BenchClock::now();
+            samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+            ret.Successful = ret.Successful && successful;
+        } //for ( std::int64_t i = 0; i < options.Repeat; ++i )
+    }
+
+    ret.Statistics = calculateStatistics(std::move(samples));
+    return ret;
+}
+
+/**
+ * @brief Lädt das Manifest, ein leerer Pfad ergibt ein leeres Manifest.
+ * @return Das Manifest oder nullopt, wenn es nicht gelesen werden konnte.
+ */
+std::optional<AnswerManifest> loadManifest(const std::filesystem::path& path) {
+    if ( path.empty() ) {
+        return AnswerManifest{};
+    } //if ( path.empty() )
+
+    try {
+        return AnswerManifest::load(path);
+    } //try
+    catch ( const std::exception& e ) {
+        myErr("Could not load answers: {:s}\n", e.what());
+        return std::nullopt;
+    } //catch ( const std::exception& e )
+}
+
+/**
+ * @brief Löst eine Challenge für viele Eingaben in einem Prozess und gibt die Ergebnisse als JSONL aus.
+ * @param[in] inputsPath Verzeichnis oder Manifest mit den Eingaben.
+ * @param[in,out] manifest Die bekannten Ergebnisse, mit --record kommen die neuen dazu.
+ * @return Der Exitcode, 0 wenn alle Eingaben gelöst wurden und die bekannten Ergebnisse stimmen.
+ */
+int runBatch(const std::filesystem::path& inputsPath, std::int64_t challengeNumber, const Options& options,
+             AnswerManifest& manifest) {
+    const auto challenge = findChallenge(challengeNumber);
+    if ( !challenge ) {
+        myErr("Challenge {:d} is not known!\n", challengeNumber);
+        return -1;
+    } //if ( !challenge )
+
+    std::vector<std::filesystem::path> inputs;
+    try {
+        inputs = collectBatchInputs(inputsPath);
+    } //try
+    catch ( const std::exception& e ) {
+        myErr("Could not collect inputs: {:s}\n", e.what());
+        return -2;
+    } //catch ( const std::exception& e )
+
+    struct BatchRun {
+        BatchResult      Result;
+        std::atomic_bool Done{false};
+    };
+
+    //Der Prozess und die Worker bleiben über alle Eingaben bestehen, nur die Eingabe selbst wird jeweils geladen.
+    std::vector<BatchRun> runs(inputs.size());
+    ThreadPool            pool{std::clamp(options.Jobs, 1uz, std::max(runs.size(), 1uz))};
+
+    for ( auto&& [run, input] : std::views::zip(runs, inputs) ) {
+        pool.submit([challenge, &options, &run, &input](void) noexcept {
+            {
+                //Die Challenges geben teilweise selbst etwas aus, das würde das JSONL kaputt machen.
+                OutputBuffer       discard{.Out = {}, .Err = {}, .Discard = true};
+                ScopedOutputBuffer scope{discard};
+                run.Result = solveBatchInput(*challenge, input, options.Part);
+            }
+            run.Done = true;
+            run.Done.notify_one();
+            return;
+        });
+    } //for ( auto&& [run, input] : std::views::zip(runs, inputs) )
+
+    //Die Ausgabe in der Reihenfolge der Eingaben, egal wann sie fertig werden.
+    bool allSolved = true;
+    for ( auto& run : runs ) {
+        run.Done.wait(false);
+        auto& result = run.Result;
+
+        if ( result.Error.empty() ) {
+            const Answers results{challengeNumber, result.Part1, result.Part2};
+            if ( !options.Reference ) {
+                result.Correct = manifest.check(result.InputHash, results);
+            } //if ( !options.Reference )
+            if ( options.Record && result.Correct.value_or(true) ) {
+                manifest.record(result.InputHash, results);
+            } //if ( options.Record && result.Correct.value_or(true) )
+        } //if ( result.Error.empty() )
+
+        myPrint("{:s}", formatBatchResult(challengeNumber, result));
+        allSolved = allSolved && result.Error.empty() && result.Correct.value_or(true);
+    } //for ( auto& run : runs )
+    myFlush();
+    return allSolved ? 0 : 1;
+}
+
+/**
+ * @brief Beantwortet Anfragen für Tiegel über der Karte von Challenge 17 und gibt pro Anfrage eine Zeile aus.
+ *
+ * Eine Anfrage ist eine Zeile "startRow startColumn targetRow targetColumn [min max]", ohne min und max gelten die
+ * normalen Tiegel.
+ * @return Der Exitcode.
+ */
+int runCrucibles(const std::filesystem::path& dataDirectory, const Options& options) {
+    try {
+        const auto                 map       = loadInput(dataDirectory, 17);
+        const auto                 queryFile = InputFile::load(options.Crucibles);
+        const IntegerTable         table{queryFile.lines()};
+        std::vector<CrucibleQuery> queries;
+        for ( auto row : table.rows() ) {
+            throwIfInvalid((row.size() == 4 || row.size() == 6) && std::ranges::min(row) >= 0, "Invalid query");
+            CrucibleQuery query{static_cast<std::size_t>(row[0]), static_cast<std::size_t>(row[1]),
+                                static_cast<std::size_t>(row[2]), static_cast<std::size_t>(row[3])};
+            if ( row.size() == 6 ) {
+                throwIfInvalid(std::max(row[4], row[5]) <= std::numeric_limits<int>::max(), "Invalid query");
+                query.MinPerDirection = static_cast<int>(row[4]);
+                query.MaxPerDirection = static_cast<int>(row[5]);
+            } //if ( row.size() == 6 )
+            queries.push_back(query);
+        } //for ( auto row : table.rows() )
+
+        ThreadPool pool{std::max(options.Jobs, 1uz)};
+        for ( auto heatLoss : routeCrucibles(map.lines(), queries, pool) ) {
+            if ( heatLoss == std::numeric_limits<std::int64_t>::max() ) {
+                myPrint("unreachable\n");
+            } //if ( heatLoss == std::numeric_limits<std::int64_t>::max() )
+            else {
+                myPrint("{:d}\n", heatLoss);
+            } //else -> if ( heatLoss == std::numeric_limits<std::int64_t>::max() )
+        } //for ( auto heatLoss : routeCrucibles(map.lines(), queries, pool) )
+        myFlush();
+        return 0;
+    } //try
+    catch ( const std::exception& e ) {
+        myErr("Could not route crucibles: {:s}\n", e.what());
+        return -2;
+    } //catch ( const std::exception& e )
+}
+} //namespace
+
 /**
  * @brief Hauptfunktion.
  * @author Björn Schäpers
@@ -49,22 +600,97 @@ using namespace std::string_view_literals;
  * @result 0 bei Erfolg.
  */
 int main(int argc, const char* argv[]) {
-    if ( argc < 3 ) {
+    std::span<const char*> arguments{argv + 1, argv + argc};
+    const auto             parsedOptions = parseOptions(arguments);
+
+    if ( !parsedOptions ) {
+        return -1;
+    } //if ( !parsedOptions )
+
+    const auto& options = *parsedOptions;
+
+    if ( !options.Serve.empty() ) {
+        if ( !arguments.empty() || options.Record ) {
+            myErr("The server takes no challenges and can not record!\n");
+            return -1;
+        } //if ( !arguments.empty() || options.Record )
+
+        const auto manifest = loadManifest(options.Answers);
+        if ( !manifest ) {
+            return -3;
+        } //if ( !manifest )
+        return runServer(options.Serve, options.Jobs, options.Part, *manifest);
+    } //if ( !options.Serve.empty() )
+
+    if ( !options.Crucibles.empty() ) {
+        if ( arguments.size() != 1 ) {
+            myErr("Routing crucibles needs exactly the data directory!\n");
+            return -1;
+        } //if ( arguments.size() != 1 )
+        return runCrucibles(arguments[0], options);
+    } //if ( !options.Crucibles.empty() )
+
+    if ( arguments.size() < 2 ) {
         myErr("Not enough parameters!");
         return -1;
-    } //if ( argc < 3 )
+    } //if ( arguments.size() < 2 )
 
-    const std::filesystem::path dataDirectory{argv[1]};
+    const std::filesystem::path dataDirectory{arguments[0]};
 
-    if ( !std::filesystem::exists(dataDirectory) ) {
+    //Ohne --answers liegt das Manifest neben den Eingaben, im Batch könnte es aber selbst als Eingabe gelten.
+    const auto answersPath = !options.Answers.empty()               ? options.Answers
+                           : options.Batch || dataDirectory == "-" ? std::filesystem::path{}
+                                                                   : dataDirectory / "answers.json";
+    if ( options.Record && answersPath.empty() ) {
+        myErr("--record needs --answers!\n");
+        return -1;
+    } //if ( options.Record && answersPath.empty() )
+
+    auto loadedManifest = loadManifest(answersPath);
+    if ( !loadedManifest ) {
+        return -3;
+    } //if ( !loadedManifest )
+    auto& manifest = *loadedManifest;
+
+    const auto saveManifest = [&options, &manifest, &answersPath](void) noexcept {
+        if ( !options.Record ) {
+            return true;
+        } //if ( !options.Record )
+
+        try {
+            manifest.save(answersPath);
+            return true;
+        } //try
+        catch ( const std::exception& e ) {
+            myErr("Could not write answers: {:s}\n", e.what());
+            return false;
+        } //catch ( const std::exception& e )
+    };
+
+    if ( options.Batch ) {
+        const auto challenge = toNumber(arguments[1]);
+        if ( arguments.size() != 2 || challenge == 0 ) {
+            myErr("Batch mode needs the inputs and exactly one challenge!\n");
+            return -1;
+        } //if ( arguments.size() != 2 || challenge == 0 )
+        const auto ret = runBatch(dataDirectory, challenge, options, manifest);
+        return saveManifest() ? ret : -3;
+    } //if ( options.Batch )
+
+    //- heißt die Eingabe kommt über stdin, das geht dann natürlich nur für eine Challenge.
+    if ( dataDirectory == "-" ) {
+        if ( arguments.size() != 2 || arguments[1] == "0"sv ) {
+            myErr("Reading from stdin only works with exactly one challenge!\n");
+            return -1;
+        } //if ( arguments.size() != 2 || arguments[1] == "0"sv )
+    } //if ( dataDirectory == "-" )
+    else if ( !std::filesystem::exists(dataDirectory) ) {
         myErr("Path {:s} does not exist!", dataDirectory.native());
         return -2;
-    } //if ( !std::filesystem::exists(dataDirectory) )
-
-    using Clock            = std::chrono::system_clock;
+    } //else if ( !std::filesystem::exists(dataDirectory) )
 
-    const std::span inputs = [&argc, &argv](void) noexcept {
-        std::span ret{argv + 2, argv + argc};
+    const std::span inputs = [&arguments](void) noexcept {
+        std::span ret = arguments.subspan(1);
         if ( ret.size() == 1 && ret[0] == "0"sv ) {
             static std::array<const char*, 25> all{"1",  "2",  "3",  "4",  "5",  "6",  "7",  "8",  "9",
                                                    "10", "11", "12", "13", "14", "15", "16", "17", "18",
@@ -73,118 +699,124 @@ int main(int argc, const char* argv[]) {
         } //if ( ret.size() == 1 && ret[0] == "0"sv )
         return ret;
     }();
-    std::vector<std::string_view> challengeInput;
-    const auto                    overallStart        = Clock::now();
-    int                           challengesRun       = 0;
-    int                           challengesSuccesful = 0;
-    auto runAndAdd = [&challengeInput, &challengesSuccesful](bool (*func)(const std::vector<std::string_view>&)) {
-        if ( func(challengeInput) ) {
-            ++challengesSuccesful;
-        } //if ( func(challengeInput) )
-        else {
-            myPrint("Failed\n");
-        } //else -> if ( func(challengeInput ) )
-        return;
-    };
 
+    std::vector<std::int64_t> challenges;
     for ( const auto& input : inputs ) {
-        const auto challenge = [](std::string_view text) noexcept -> std::int64_t {
-            try {
-                return convert(text);
-            } //try
-            catch ( ... ) {
-                return 0;
-            }
-        }({input, std::strlen(input)});
+        const auto challenge = toNumber({input, std::strlen(input)});
 
         if ( challenge == 0 ) {
             myErr("{:s} is not a valid challenge identifier!\n", input);
             continue;
         } //if ( challenge == 0 )
+        challenges.push_back(challenge);
+    } //for ( const auto& input : inputs )
 
-        const auto inputFilePath = dataDirectory / std::format("{:d}.txt", challenge);
+    if ( options.Bench ) {
+        //Benchmarks laufen immer nacheinander, sonst stören sie sich gegenseitig. --jobs gehört dann der Challenge.
+        setChallengeJobs(options.Jobs);
+        std::vector<BenchmarkResult> results;
+        for ( auto challenge : challenges ) {
+            try {
+                const auto& result =
+                    results.emplace_back(benchmarkChallenge(dataDirectory, challenge, options, manifest));
+                const auto& s      = result.Statistics;
+                myPrint(" == Challenge {:d}{:s}: {:d} runs, min {}, median {}, p90 {}, p99 {}, stddev {:.0f}ns ==\n",
+                        challenge, result.Successful ? "" : " (Failed)", s.Runs, s.Min, s.Median, s.P90, s.P99,
+                        s.StdDev);
+            } //try
+            catch ( const std::exception& e ) {
+                myErr("Skipping Challenge {:d}: {:s}\n", challenge, e.what());
+            } //catch ( const std::exception& e )
+        } //for ( auto challenge : challenges )
 
-        try {
+        if ( !options.Report.empty() ) {
+            try {
+                writeBenchmarkReport(options.Report, results);
+            } //try
+            catch ( const std::exception& e ) {
+                myErr("Could not write report: {:s}\n", e.what());
+                return -3;
+            } //catch ( const std::exception& e )
+        } //if ( !options.Report.empty() )
+
+        return std::ranges::all_of(results, &BenchmarkResult::Successful) ? 0 : 1;
+    } //if ( options.Bench )
+
+    const auto                overallStart        = Clock::now();
+    int                       challengesRun        = 0;
+    int                       challengesSuccesful  = 0;
+    int                       challengesUnverified = 0;
+    std::vector<ChallengeRun> runs(challenges.size());
+
+    auto addRun = [&challengesRun, &challengesSuccesful, &challengesUnverified](const ChallengeRun& run) noexcept {
+        if ( run.Run ) {
             ++challengesRun;
-            if ( !std::filesystem::exists(inputFilePath) ) {
-                throw std::runtime_error{std::format("\"{:s}\" does not exist!", inputFilePath.c_str())};
-            } //if ( !std::filesystem::exists(inputFilePath) )
-
-            if ( !std::filesystem::is_regular_file(inputFilePath) ) {
-                throw std::runtime_error{std::format("\"{:s}\" is not a file!", inputFilePath.c_str())};
-            } //if ( !std::filesystem::is_regular_file(inputFilePath) )
-
-            std::ifstream inputFile{inputFilePath};
-
-            if ( !inputFile ) {
-                throw std::runtime_error{std::format("Could not open \"{:s}\"!", inputFilePath.c_str())};
-            } //if ( !inputFile )
-
-            challengeInput.clear();
-            inputFile.seekg(0, std::ios::end);
-            const auto size = inputFile.tellg();
-            inputFile.seekg(0, std::ios::beg);
-            std::string fileContent(static_cast<std::size_t>(size), ' ');
-            inputFile.read(fileContent.data(), size);
-            std::ranges::copy(splitString<false>(fileContent, '\n'), std::back_inserter(challengeInput));
-            auto lastNonEmpty = std::ranges::find_last_if_not(challengeInput, &std::string_view::empty);
-            if ( lastNonEmpty.begin() != challengeInput.end() ) {
-                challengeInput.erase(std::next(lastNonEmpty.begin()), lastNonEmpty.end());
-            } //if ( lastNonEmpty.begin() != challengeInput.end() )
-
-            myPrint(" == Starting Challenge {:d} ==\n", challenge);
-            const auto start = Clock::now();
-
-            switch ( challenge ) {
-                case 1  : runAndAdd(challenge1); break;
-                case 2  : runAndAdd(challenge2); break;
-                case 3  : runAndAdd(challenge3); break;
-                case 4  : runAndAdd(challenge4); break;
-                case 5  : runAndAdd(challenge5); break;
-                case 6  : runAndAdd(challenge6); break;
-                case 7  : runAndAdd(challenge7); break;
-                case 8  : runAndAdd(challenge8); break;
-                case 9  : runAndAdd(challenge9); break;
-                case 10 : runAndAdd(challenge10); break;
-                case 11 : runAndAdd(challenge11); break;
-                case 12 : runAndAdd(challenge12); break;
-                case 13 : runAndAdd(challenge13); break;
-                case 14 : runAndAdd(challenge14); break;
-                case 15 : runAndAdd(challenge15); break;
-                case 16 : runAndAdd(challenge16); break;
-                case 17 : runAndAdd(challenge17); break;
-                case 18 : runAndAdd(challenge18); break;
-                case 19 : runAndAdd(challenge19); break;
-                case 20 : runAndAdd(challenge20); break;
-                case 21 : runAndAdd(challenge21); break;
-                case 22 : runAndAdd(challenge22); break;
-                case 23 : runAndAdd(challenge23); break;
-                case 24 : runAndAdd(challenge24); break;
-                case 25 : runAndAdd(challenge25); break;
-
-                default : {
-                    --challengesRun;
-                    myErr("Challenge {:d} is not known!\n", challenge);
-                    break;
-                } //default
-            } //switch ( challenge )
-
-            const auto end      = Clock::now();
-            const auto duration = end - start;
-            myPrint(" == End of Challenge {:d} after {} ==\n\n", challenge,
-                    std::chrono::duration_cast<std::chrono::milliseconds>(duration));
-        } //try
-        catch ( const std::exception& e ) {
-            --challengesRun;
-            myErr("Skipping Challenge {:d}: {:s}\n", challenge, e.what());
-        } //catch ( const std::exception& e)
-    } //for ( const auto& input : inputs )
+        } //if ( run.Run )
+        if ( run.Successful ) {
+            ++challengesSuccesful;
+        } //if ( run.Successful )
+        if ( run.Unverified ) {
+            ++challengesUnverified;
+        } //if ( run.Unverified )
+        return;
+    };
+
+    for ( auto&& [run, challenge] : std::views::zip(runs, challenges) ) {
+        run.Challenge = challenge;
+    } //for ( auto&& [run, challenge] : std::views::zip(runs, challenges) )
+
+    //Was die Challenges nicht selbst belegen, dürfen sie für ihre Teile nutzen, etwa bei --jobs 8 nur für Challenge 16.
+    setChallengeJobs(options.Jobs / std::max(runs.size(), 1uz));
+
+    if ( options.Jobs <= 1 ) {
+        for ( auto& run : runs ) {
+            runChallenge(dataDirectory, options, manifest, run);
+            addRun(run);
+        } //for ( auto& run : runs )
+    } //if ( options.Jobs <= 1 )
+    else {
+        ThreadPool pool{std::min(options.Jobs, runs.size())};
+
+        for ( auto& run : runs ) {
+            pool.submit([&dataDirectory, &options, &manifest, &run](void) noexcept {
+                {
+                    ScopedOutputBuffer buffer{run.Output};
+                    runChallenge(dataDirectory, options, manifest, run);
+                }
+                run.Done = true;
+                run.Done.notify_one();
+                return;
+            });
+        } //for ( auto& run : runs )
+
+        //Die Ausgabe in der Reihenfolge der Challenges, egal wann sie fertig werden.
+        for ( auto& run : runs ) {
+            run.Done.wait(false);
+            myFlush(run.Output);
+            addRun(run);
+        } //for ( auto& run : runs )
+    } //else -> if ( options.Jobs <= 1 )
+
+    if ( options.Record ) {
+        for ( const auto& run : runs ) {
+            if ( run.Run && !run.Successful && !run.Unverified ) {
+                myErr("Not recording Challenge {:d}, it does not match the known answers!\n", run.Challenge);
+            } //if ( run.Run && !run.Successful && !run.Unverified )
+            else if ( run.Run ) {
+                manifest.record(run.InputHash, run.Results);
+            } //else if ( run.Run )
+        } //for ( const auto& run : runs )
+
+        if ( !saveManifest() ) {
+            return -3;
+        } //if ( !saveManifest() )
+    } //if ( options.Record )
 
     const auto overallEnd      = Clock::now();
     const auto overallDuration = overallEnd - overallStart;
-    myPrint("After {} {:d} challenges correctly solved from {:d} ({:.2f}%)\n",
+    myPrint("After {} {:d} challenges correctly solved from {:d} ({:.2f}%), {:d} without known answers\n",
             std::chrono::duration_cast<std::chrono::milliseconds>(overallDuration), challengesSuccesful, challengesRun,
-            challengesSuccesful * 100. / std::max(challengesRun, 1));
+            challengesSuccesful * 100. / std::max(challengesRun, 1), challengesUnverified);
 
     return 0;
 }
@@ -0,0 +1,133 @@
+#include "perf.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <iterator>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+struct EventConfig {
+    std::uint32_t Type;
+    std::uint64_t Config;
+};
+
+constexpr std::uint64_t cacheMiss(std::uint64_t cache) noexcept {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+//Die Reihenfolge muss zu den Membern von PerfCounts passen, die Anzahl zu PerfCounters::NumberOfCounters.
+constexpr std::array Events{
+    EventConfig{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    EventConfig{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    EventConfig{PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+    EventConfig{PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_LL)},
+    EventConfig{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+int openEvent(const EventConfig& event) noexcept {
+    perf_event_attr attributes{};
+    attributes.size           = sizeof(attributes);
+    attributes.type           = event.Type;
+    attributes.config         = event.Config;
+    attributes.disabled       = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv     = 1;
+    attributes.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    //Dieser Thread, jede CPU, keine Gruppe.
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+void formatCount(std::back_insert_iterator<std::string> out, std::string_view name,
+                 const std::optional<std::uint64_t>& count) {
+    if ( count ) {
+        std::format_to(out, " {:s} {:d}", name, *count);
+    } //if ( count )
+    else {
+        std::format_to(out, " {:s} n/a", name);
+    } //else -> if ( count )
+    return;
+}
+} //namespace
+
+std::string formatPerfCounts(const PerfCounts& counts) {
+    std::string ret;
+    auto        out = std::back_inserter(ret);
+    formatCount(out, "cycles", counts.Cycles);
+    formatCount(out, "instructions", counts.Instructions);
+    if ( counts.Cycles && counts.Instructions && *counts.Cycles != 0 ) {
+        std::format_to(out, " IPC {:.2f}",
+                       static_cast<double>(*counts.Instructions) / static_cast<double>(*counts.Cycles));
+    } //if ( counts.Cycles && counts.Instructions && *counts.Cycles != 0 )
+    formatCount(out, "L1d-misses", counts.L1DMisses);
+    formatCount(out, "LLC-misses", counts.LLCMisses);
+    formatCount(out, "branch-misses", counts.BranchMisses);
+    return ret;
+}
+
+PerfCounters::PerfCounters(void) noexcept {
+    static_assert(Events.size() == NumberOfCounters, "Every event needs its own fd");
+    std::ranges::transform(Events, Fds.begin(), openEvent);
+    return;
+}
+
+PerfCounters::~PerfCounters(void) {
+    for ( auto fd : Fds ) {
+        if ( fd >= 0 ) {
+            ::close(fd);
+        } //if ( fd >= 0 )
+    } //for ( auto fd : Fds )
+    return;
+}
+
+bool PerfCounters::available(void) const noexcept {
+    return std::ranges::any_of(Fds, [](int fd) noexcept { return fd >= 0; });
+}
+
+void PerfCounters::start(void) noexcept {
+    for ( auto fd : Fds ) {
+        if ( fd >= 0 ) {
+            ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        } //if ( fd >= 0 )
+    } //for ( auto fd : Fds )
+    return;
+}
+
+PerfCounts PerfCounters::stop(void) noexcept {
+    for ( auto fd : Fds ) {
+        if ( fd >= 0 ) {
+            ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        } //if ( fd >= 0 )
+    } //for ( auto fd : Fds )
+    return {read(0), read(1), read(2), read(3), read(4)};
+}
+
+std::optional<std::uint64_t> PerfCounters::read(std::size_t index) const noexcept {
+    const auto fd = Fds[index];
+    if ( fd < 0 ) {
+        return std::nullopt;
+    } //if ( fd < 0 )
+
+    struct {
+        std::uint64_t Value;
+        std::uint64_t TimeEnabled;
+        std::uint64_t TimeRunning;
+    } data;
+
+    if ( ::read(fd, &data, sizeof(data)) != sizeof(data) || data.TimeRunning == 0 ) {
+        return std::nullopt;
+    } //if ( ::read(fd, &data, sizeof(data)) != sizeof(data) || data.TimeRunning == 0 )
+
+    if ( data.TimeRunning == data.TimeEnabled ) {
+        return data.Value;
+    } //if ( data.TimeRunning == data.TimeEnabled )
+
+    //Der Kernel hat multiplext, auf die volle Zeit hochrechnen.
+    return static_cast<std::uint64_t>(static_cast<double>(data.Value) * static_cast<double>(data.TimeEnabled) /
+                                      static_cast<double>(data.TimeRunning));
+}
@@ -0,0 +1,63 @@
+#ifndef PERF_HPP
+#define PERF_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/**
+ * @brief Die Zählerstände einer Messung, nullopt wenn der Zähler auf dieser Maschine nicht verfügbar ist.
+ */
+struct PerfCounts {
+    std::optional<std::uint64_t> Cycles;
+    std::optional<std::uint64_t> Instructions;
+    std::optional<std::uint64_t> L1DMisses;
+    std::optional<std::uint64_t> LLCMisses;
+    std::optional<std::uint64_t> BranchMisses;
+};
+
+/**
+ * @brief Formatiert die Zähler für die Ausgabe, inklusive der Instruktionen pro Takt.
+ */
+std::string formatPerfCounts(const PerfCounts& counts);
+
+/**
+ * @brief Hardware-Zähler über perf_event_open für den aktuellen Thread.
+ *
+ * Es wird nur der Thread gezählt, der das Objekt erzeugt hat, keine Threads die innerhalb der Messung gestartet
+ * werden.
+ * Zähler die der Kernel ablehnt (z.B. in VMs oder wegen perf_event_paranoid) werden einfach ausgelassen.
+ */
+class PerfCounters {
+    public:
+    PerfCounters(void) noexcept;
+    ~PerfCounters(void);
+
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Ob überhaupt ein Zähler geöffnet werden konnte.
+     */
+    bool available(void) const noexcept;
+
+    /**
+     * @brief Setzt die Zähler zurück und startet sie.
+     */
+    void start(void) noexcept;
+
+    /**
+     * @brief Hält die Zähler an und liefert die seit start() gezählten Ereignisse.
+     */
+    PerfCounts stop(void) noexcept;
+
+    private:
+    static constexpr std::size_t NumberOfCounters = 5;
+
+    std::array<int, NumberOfCounters> Fds;
+
+    std::optional<std::uint64_t> read(std::size_t index) const noexcept;
+};
+
+#endif //PERF_HPP
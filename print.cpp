@@ -1,11 +1,107 @@
 #include "print.hpp"
 
-#include <iostream>
+#include <cerrno>
+#include <mutex>
+#include <string_view>
+#include <utility>
 
-std::ostream_iterator<char> outIterator{std::cout};
-std::ostream_iterator<char> errIterator{std::cerr};
+#include <unistd.h>
+
+namespace {
+//! Ab dieser Größe wird der Puffer eines Threads auch ohne Terminal ausgegeben.
+constexpr std::size_t flushThreshold = 64uz * 1024;
+
+thread_local OutputBuffer* CurrentBuffer = nullptr;
+
+//! Hält die Ausgabe eines Puffers zusammen, stdout und stderr eines Threads kommen so in der richtigen Reihenfolge.
+std::mutex OutputMutex;
+
+void writeAll(int fd, std::string_view data) noexcept {
+    while ( !data.empty() ) {
+        const auto written = ::write(fd, data.data(), data.size());
+        if ( written < 0 ) {
+            if ( errno == EINTR ) {
+                continue;
+            } //if ( errno == EINTR )
+            //Wohin auch sonst mit dem Fehler? Die Ausgabe geht verloren, wie bei std::cout auch.
+            return;
+        } //if ( written < 0 )
+        data.remove_prefix(static_cast<std::size_t>(written));
+    } //while ( !data.empty() )
+    return;
+}
+
+void writeBuffer(OutputBuffer& buffer) noexcept {
+    if ( buffer.Out.empty() && buffer.Err.empty() ) {
+        return;
+    } //if ( buffer.Out.empty() && buffer.Err.empty() )
+
+    {
+        std::lock_guard lock{OutputMutex};
+        writeAll(STDOUT_FILENO, buffer.Out);
+        writeAll(STDERR_FILENO, buffer.Err);
+    }
+    buffer.Out.clear();
+    buffer.Err.clear();
+    return;
+}
+
+struct ThreadOutput {
+    OutputBuffer Buffer;
+
+    ~ThreadOutput(void) {
+        writeBuffer(Buffer);
+        return;
+    }
+};
+
+thread_local ThreadOutput PendingOutput;
+
+bool stdoutIsTerminal(void) noexcept {
+    static const bool ret = ::isatty(STDOUT_FILENO) == 1;
+    return ret;
+}
+} //namespace
+
+OutputBuffer* currentOutputBuffer(void) noexcept {
+    return CurrentBuffer;
+}
+
+ScopedOutputBuffer::ScopedOutputBuffer(OutputBuffer& buffer) noexcept :
+        Previous{std::exchange(CurrentBuffer, &buffer)} {
+    return;
+}
+
+ScopedOutputBuffer::~ScopedOutputBuffer(void) {
+    CurrentBuffer = Previous;
+    return;
+}
+
+OutputBuffer& detail::threadOutput(void) noexcept {
+    return PendingOutput.Buffer;
+}
+
+void detail::commitThreadOutput(void) {
+    auto& buffer = PendingOutput.Buffer;
+    if ( !buffer.Err.empty() || buffer.Out.size() >= flushThreshold ||
+         (stdoutIsTerminal() && buffer.Out.ends_with('\n')) ) {
+        writeBuffer(buffer);
+    } //if ( !buffer.Err.empty() || buffer.Out.size() >= flushThreshold || ... )
+    return;
+}
 
 void myFlush() {
-    std::cout.flush();
+    if ( CurrentBuffer ) {
+        //Wird gepuffert, flushen übernimmt der Besitzer des Puffers.
+        return;
+    } //if ( CurrentBuffer )
+    writeBuffer(PendingOutput.Buffer);
+    return;
+}
+
+void myFlush(OutputBuffer& buffer) {
+    //Was der Thread selbst noch hat, kam vorher.
+    writeBuffer(PendingOutput.Buffer);
+    writeBuffer(buffer);
     return;
 }
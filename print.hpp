@@ -3,21 +3,83 @@
 
 #include <format>
 #include <iterator>
-#include <ostream>
+#include <string>
 
-extern std::ostream_iterator<char> outIterator;
-extern std::ostream_iterator<char> errIterator;
+/**
+ * @brief Sammelt die Ausgaben einer Challenge, damit parallel laufende Challenges sich nicht gegenseitig die Ausgabe
+ * zerschießen.
+ */
+struct OutputBuffer {
+    std::string Out;
+    std::string Err;
+    //! Die Ausgaben werden gar nicht erst formatiert, z.B. beim Benchmarken.
+    bool        Discard = false;
+};
+
+OutputBuffer* currentOutputBuffer(void) noexcept;
+
+/**
+ * @brief Leitet alle Ausgaben des aktuellen Threads in einen Puffer um, solange das Objekt lebt.
+ */
+class ScopedOutputBuffer {
+    public:
+    explicit ScopedOutputBuffer(OutputBuffer& buffer) noexcept;
+    ~ScopedOutputBuffer(void);
+
+    ScopedOutputBuffer(const ScopedOutputBuffer&)            = delete;
+    ScopedOutputBuffer& operator=(const ScopedOutputBuffer&) = delete;
+
+    private:
+    OutputBuffer* Previous;
+};
+
+namespace detail {
+/**
+ * @brief Der Puffer des Threads, wenn nicht umgeleitet wird. Er wird beim Ende des Threads ausgegeben.
+ */
+OutputBuffer& threadOutput(void) noexcept;
+
+/**
+ * @brief Gibt den Puffer des Threads aus, wenn es Zeit wird: stderr sofort, stdout wenn der Puffer voll ist oder,
+ * bei einem Terminal, am Zeilenende.
+ */
+void commitThreadOutput(void);
+
+template<auto Member, typename... Args>
+void print(std::format_string<Args...> str, Args&&... args) {
+    if ( auto buffer = currentOutputBuffer() ) {
+        if ( !buffer->Discard ) {
+            std::format_to(std::back_inserter(buffer->*Member), str, std::forward<Args>(args)...);
+        } //if ( !buffer->Discard )
+        return;
+    } //if ( auto buffer = currentOutputBuffer() )
+
+    std::format_to(std::back_inserter(threadOutput().*Member), str, std::forward<Args>(args)...);
+    commitThreadOutput();
+    return;
+}
+} //namespace detail
 
 template<typename... Args>
 void myPrint(std::format_string<Args...> str, Args&&... args) {
-    std::format_to(outIterator, str, std::forward<Args>(args)...);
+    detail::print<&OutputBuffer::Out>(str, std::forward<Args>(args)...);
+    return;
 }
 
 template<typename... Args>
 void myErr(std::format_string<Args...> str, Args&&... args) {
-    std::format_to(errIterator, str, std::forward<Args>(args)...);
+    detail::print<&OutputBuffer::Err>(str, std::forward<Args>(args)...);
+    return;
 }
 
+/**
+ * @brief Gibt die gepufferte Ausgabe des Threads aus, außer sie wird gerade umgeleitet.
+ */
 void myFlush();
 
+/**
+ * @brief Gibt den Inhalt des Puffers aus und leert ihn.
+ */
+void myFlush(OutputBuffer& buffer);
+
 #endif //PRINT_HPP
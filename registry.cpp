@@ -0,0 +1,44 @@
+#include "registry.hpp"
+
+#include "challenge1.hpp"
+#include "challenge10.hpp"
+#include "challenge11.hpp"
+#include "challenge12.hpp"
+#include "challenge13.hpp"
+#include "challenge14.hpp"
+#include "challenge15.hpp"
+#include "challenge16.hpp"
+#include "challenge17.hpp"
+#include "challenge18.hpp"
+#include "challenge19.hpp"
+#include "challenge2.hpp"
+#include "challenge20.hpp"
+#include "challenge21.hpp"
+#include "challenge22.hpp"
+#include "challenge23.hpp"
+#include "challenge24.hpp"
+#include "challenge25.hpp"
+#include "challenge3.hpp"
+#include "challenge4.hpp"
+#include "challenge5.hpp"
+#include "challenge6.hpp"
+#include "challenge7.hpp"
+#include "challenge8.hpp"
+#include "challenge9.hpp"
+
+#include <array>
+
+const Challenge* findChallenge(std::int64_t number) noexcept {
+    static const std::array challenges{
+        &challenge1(),  &challenge2(),  &challenge3(),  &challenge4(),  &challenge5(),
+        &challenge6(),  &challenge7(),  &challenge8(),  &challenge9(),  &challenge10(),
+        &challenge11(), &challenge12(), &challenge13(), &challenge14(), &challenge15(),
+        &challenge16(), &challenge17(), &challenge18(), &challenge19(), &challenge20(),
+        &challenge21(), &challenge22(), &challenge23(), &challenge24(), &challenge25(),
+    };
+
+    if ( number < 1 || number > static_cast<std::int64_t>(challenges.size()) ) {
+        return nullptr;
+    } //if ( number < 1 || number > static_cast<std::int64_t>(challenges.size()) )
+    return challenges[static_cast<std::size_t>(number - 1)];
+}
@@ -0,0 +1,14 @@
+#ifndef REGISTRY_HPP
+#define REGISTRY_HPP
+
+#include "challenge.hpp"
+
+#include <cstdint>
+
+/**
+ * @brief Sucht die Challenge mit der Nummer.
+ * @return Die Challenge oder nullptr, wenn es sie nicht gibt.
+ */
+const Challenge* findChallenge(std::int64_t number) noexcept;
+
+#endif //REGISTRY_HPP
@@ -0,0 +1,470 @@
+#include "server.hpp"
+
+#include "answers.hpp"
+#include "batch.hpp"
+#include "helper.hpp"
+#include "input.hpp"
+#include "print.hpp"
+#include "registry.hpp"
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+//! Mehr nimmt der Server nicht an, die größten echten Eingaben liegen bei etwa 25 KiB.
+constexpr std::size_t maxInputSize  = 4uz * 1024 * 1024;
+constexpr std::size_t maxHeaderSize = 64;
+constexpr std::size_t receiveSize   = 64uz * 1024;
+//! Liest ein Client seine Antwort nicht, gibt der Worker nach dieser Zeit auf.
+constexpr timeval     sendTimeout{.tv_sec = 10, .tv_usec = 0};
+//! Ist der Cache voll, wird er geleert, die Anfragen wiederholen sich typischerweise in kurzen Abständen.
+constexpr std::size_t maxCacheSize  = 4096;
+
+std::atomic_bool StopRequested{false};
+
+extern "C" void requestStop(int) {
+    StopRequested = true;
+    return;
+}
+
+/**
+ * @brief Die Ergebnisse nach Challenge, Teil und Hash der Eingabe.
+ */
+class ResultCache {
+    public:
+    std::optional<BatchResult> find(std::int64_t challenge, int part, std::uint64_t hash) {
+        std::lock_guard lock{Mutex};
+        const auto      iter = Entries.find({challenge, part, hash});
+        if ( iter == Entries.end() ) {
+            return std::nullopt;
+        } //if ( iter == Entries.end() )
+        return iter->second;
+    }
+
+    void insert(std::int64_t challenge, int part, const BatchResult& result) {
+        std::lock_guard lock{Mutex};
+        if ( Entries.size() >= maxCacheSize ) {
+            Entries.clear();
+        } //if ( Entries.size() >= maxCacheSize )
+        Entries.insert_or_assign({challenge, part, result.InputHash}, result);
+        return;
+    }
+
+    private:
+    using Key = std::tuple<std::int64_t, int, std::uint64_t>;
+
+    std::mutex                 Mutex;
+    std::map<Key, BatchResult> Entries;
+};
+
+std::optional<std::int64_t> toNumber(std::string_view text) noexcept {
+    try {
+        return convertOptionally(text);
+    } //try
+    catch ( ... ) {
+        return std::nullopt;
+    }
+}
+
+/**
+ * @brief Eine vollständig gelesene Anfrage.
+ */
+struct Request {
+    std::int64_t      Challenge = 0;
+    std::vector<char> Input;
+    //! Der Kopf war ungültig, danach weiß man nicht, wo die nächste Anfrage beginnt.
+    bool              Invalid   = false;
+};
+
+/**
+ * @brief Eine Verbindung eines Clients, liest ohne zu warten und schreibt ohne SIGPIPE.
+ *
+ * Gelesen wird nur vom Listener, bis eine Anfrage vollständig ist. Ein Worker bekommt erst die fertige Anfrage und
+ * schreibt nur noch die Antwort.
+ */
+class Connection {
+    public:
+    explicit Connection(int fd) noexcept : Fd{fd} {
+        ::setsockopt(Fd, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+        return;
+    }
+
+    ~Connection(void) {
+        ::close(Fd);
+        return;
+    }
+
+    Connection(const Connection&)            = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    /**
+     * @brief Liest, was gerade da ist, ohne zu warten. Der Puffer wächst nur mit den Daten, die wirklich ankommen.
+     * @return Ob die Verbindung noch offen ist.
+     */
+    bool receive(void) {
+        const auto oldSize = Buffer.size();
+        Buffer.resize(oldSize + receiveSize);
+        for ( ;; ) {
+            const auto bytesRead = ::recv(Fd, Buffer.data() + oldSize, receiveSize, MSG_DONTWAIT);
+            if ( bytesRead < 0 && errno == EINTR ) {
+                continue;
+            } //if ( bytesRead < 0 && errno == EINTR )
+
+            Buffer.resize(oldSize + (bytesRead > 0 ? static_cast<std::size_t>(bytesRead) : 0));
+            return bytesRead > 0 || (bytesRead < 0 && errno == EAGAIN);
+        } //for ( ;; )
+    }
+
+    /**
+     * @brief Nimmt die nächste Anfrage aus dem Puffer.
+     * @return Die Anfrage oder nullopt, solange sie noch nicht vollständig gelesen ist.
+     */
+    std::optional<Request> takeRequest(void) {
+        const auto searched  = std::min(Buffer.size(), maxHeaderSize + 1);
+        const auto headerEnd = std::find(Buffer.begin(), Buffer.begin() + static_cast<std::ptrdiff_t>(searched), '\n');
+        if ( headerEnd == Buffer.begin() + static_cast<std::ptrdiff_t>(searched) ) {
+            if ( searched > maxHeaderSize ) {
+                return Request{.Challenge = 0, .Input = {}, .Invalid = true};
+            } //if ( searched > maxHeaderSize )
+            return std::nullopt;
+        } //if ( headerEnd == Buffer.begin() + static_cast<std::ptrdiff_t>(searched) )
+
+        const std::string_view        header{Buffer.data(), static_cast<std::size_t>(headerEnd - Buffer.begin())};
+        std::vector<std::string_view> fields;
+        std::ranges::copy(splitString(header, ' '), std::back_inserter(fields));
+        const auto challengeNumber = fields.size() == 2 ? toNumber(fields[0]) : std::nullopt;
+        const auto size            = fields.size() == 2 ? toNumber(fields[1]) : std::nullopt;
+        if ( !challengeNumber || !size || *size < 0 || static_cast<std::size_t>(*size) > maxInputSize ) {
+            return Request{.Challenge = 0, .Input = {}, .Invalid = true};
+        } //if ( !challengeNumber || !size || ... )
+
+        const auto bodyBegin = headerEnd + 1;
+        if ( Buffer.end() - bodyBegin < *size ) {
+            return std::nullopt;
+        } //if ( Buffer.end() - bodyBegin < *size )
+
+        const auto bodyEnd = bodyBegin + static_cast<std::ptrdiff_t>(*size);
+        Request    ret{.Challenge = *challengeNumber, .Input = {bodyBegin, bodyEnd}, .Invalid = false};
+        Buffer.erase(Buffer.begin(), bodyEnd);
+        return ret;
+    }
+
+    bool write(std::string_view data) noexcept {
+        while ( !data.empty() ) {
+            const auto written = ::send(Fd, data.data(), data.size(), MSG_NOSIGNAL);
+            if ( written < 0 ) {
+                if ( errno == EINTR ) {
+                    continue;
+                } //if ( errno == EINTR )
+                return false;
+            } //if ( written < 0 )
+            data.remove_prefix(static_cast<std::size_t>(written));
+        } //while ( !data.empty() )
+        return true;
+    }
+
+    private:
+    int               Fd;
+    //! Gelesen, aber noch keiner Anfrage zugeordnet.
+    std::vector<char> Buffer;
+};
+
+std::string errorResponse(std::int64_t challenge, std::string_view error) {
+    BatchResult result;
+    result.Error = error;
+    return formatBatchResult(challenge, result);
+}
+
+/**
+ * @brief Beantwortet genau eine Anfrage.
+ * @return Ob die Verbindung für weitere Anfragen offen bleibt.
+ */
+bool serveRequest(Connection& connection, Request& request, int part, const AnswerManifest& manifest,
+                  ResultCache& cache) noexcept {
+    try {
+        //Die Challenges geben teilweise selbst etwas aus, das gehört nicht in das Log des Servers.
+        OutputBuffer       discard{.Out = {}, .Err = {}, .Discard = true};
+        ScopedOutputBuffer scope{discard};
+
+        if ( request.Invalid ) {
+            connection.write(errorResponse(0, "Invalid request header"));
+            return false;
+        } //if ( request.Invalid )
+
+        const auto challenge = findChallenge(request.Challenge);
+        if ( !challenge ) {
+            return connection.write(errorResponse(request.Challenge, "Unknown challenge"));
+        } //if ( !challenge )
+
+        const auto input  = InputFile::fromBuffer(std::move(request.Input));
+        const auto hash   = hashInput(input.content());
+        auto       result = cache.find(request.Challenge, part, hash);
+        if ( result ) {
+            result->Cached = true;
+        } //if ( result )
+        else {
+            result = solveInput(*challenge, input, part);
+            if ( result->Error.empty() ) {
+                result->Correct = manifest.check(hash, {request.Challenge, result->Part1, result->Part2});
+                cache.insert(request.Challenge, part, *result);
+            } //if ( result->Error.empty() )
+        } //else -> if ( result )
+
+        return connection.write(formatBatchResult(request.Challenge, *result));
+    } //try
+    catch ( const std::exception& e ) {
+        myErr("Connection failed: {:s}\n", e.what());
+    } //catch ( const std::exception& e )
+    catch ( ... ) {
+        myErr("Connection failed: Unknown exception\n");
+    } //catch ( ... )
+    return false;
+}
+
+/**
+ * @brief Die offenen Verbindungen, jede Anfrage ist eine eigene Aufgabe im Pool.
+ *
+ * Wartet eine Verbindung auf ihre nächste Anfrage, belegt sie keinen Worker, auf sie wartet nur der Listener mit poll.
+ * Er liest auch die Anfrage, erst wenn sie vollständig ist, kommt sie in den Pool. Ist die Anfrage beantwortet, gibt
+ * der Worker die Verbindung über eine Pipe an den Listener zurück. So kann ein Client, der verbunden bleibt oder seine
+ * Anfrage nur halb schickt, die anderen nicht blockieren, auch nicht mit nur einem Worker. Nur der Listener legt
+ * Verbindungen an und schließt sie.
+ */
+class ConnectionSet {
+    public:
+    ConnectionSet(int part, const AnswerManifest& manifest, ResultCache& cache) noexcept :
+            Part{part}, Manifest{manifest}, Cache{cache} {
+        if ( ::pipe2(WakeUp.data(), O_CLOEXEC | O_NONBLOCK) != 0 ) {
+            WakeUp = {-1, -1};
+        } //if ( ::pipe2(WakeUp.data(), O_CLOEXEC | O_NONBLOCK) != 0 )
+        return;
+    }
+
+    ~ConnectionSet(void) {
+        for ( int fd : WakeUp ) {
+            if ( fd >= 0 ) {
+                ::close(fd);
+            } //if ( fd >= 0 )
+        } //for ( int fd : WakeUp )
+        return;
+    }
+
+    ConnectionSet(const ConnectionSet&)            = delete;
+    ConnectionSet& operator=(const ConnectionSet&) = delete;
+
+    bool valid(void) const noexcept {
+        return WakeUp[0] >= 0;
+    }
+
+    void add(int fd) {
+        Connections.emplace(fd, std::make_unique<Connection>(fd));
+        return;
+    }
+
+    /**
+     * @brief Wartet auf den Listener, auf zurückgegebene und auf lesbare Verbindungen oder ein Signal. Ist eine
+     * Anfrage vollständig gelesen, kommt sie sofort in den Pool.
+     * @param[in] signals Die Signalmaske während des Wartens, außerhalb sollen SIGINT und SIGTERM blockiert sein.
+     * Sonst könnte ein Signal zwischen der Prüfung auf StopRequested und dem Warten verloren gehen.
+     * @return Ob auf dem Listener eine neue Verbindung wartet.
+     */
+    bool poll(int listenFd, ThreadPool& pool, const sigset_t& signals) {
+        std::vector<pollfd> fds{{listenFd, POLLIN, 0}, {WakeUp[0], POLLIN, 0}};
+        for ( const auto& [fd, connection] : Connections ) {
+            if ( !Busy.contains(fd) ) {
+                fds.push_back({fd, POLLIN, 0});
+            } //if ( !Busy.contains(fd) )
+        } //for ( const auto& [fd, connection] : Connections )
+
+        if ( ::ppoll(fds.data(), fds.size(), nullptr, &signals) < 0 ) {
+            if ( errno != EINTR ) {
+                myErr("Poll failed: {:s}\n", std::strerror(errno));
+            } //if ( errno != EINTR )
+            return false;
+        } //if ( ::ppoll(fds.data(), fds.size(), nullptr, &signals) < 0 )
+
+        for ( const auto& entry : fds | std::views::drop(2) ) {
+            if ( entry.revents == 0 ) {
+                continue;
+            } //if ( entry.revents == 0 )
+
+            if ( Connections.at(entry.fd)->receive() ) {
+                serveNext(entry.fd, pool);
+            } //if ( Connections.at(entry.fd)->receive() )
+            else {
+                //Eine halb gelesene Anfrage wird nie mehr vollständig.
+                Connections.erase(entry.fd);
+            } //else -> if ( Connections.at(entry.fd)->receive() )
+        } //for ( const auto& entry : fds | std::views::drop(2) )
+
+        if ( fds[1].revents != 0 ) {
+            takeBack(pool);
+        } //if ( fds[1].revents != 0 )
+        return (fds[0].revents & POLLIN) != 0;
+    }
+
+    private:
+    int                                        Part;
+    const AnswerManifest&                      Manifest;
+    ResultCache&                               Cache;
+    std::array<int, 2>                         WakeUp{-1, -1};
+    std::map<int, std::unique_ptr<Connection>> Connections;
+    //! Die Verbindungen, deren Anfrage gerade im Pool ist. Gehört wie Connections nur dem Listener.
+    std::set<int>                              Busy;
+    std::mutex                                 Mutex;
+    //! Von den Workern zurückgegeben, mit der Angabe, ob die Verbindung offen bleibt.
+    std::vector<std::pair<int, bool>>          Returned;
+
+    /**
+     * @brief Gibt die nächste Anfrage der Verbindung in den Pool, falls sie schon vollständig gelesen ist.
+     */
+    void serveNext(int fd, ThreadPool& pool) {
+        auto request = Connections.at(fd)->takeRequest();
+        if ( !request ) {
+            return;
+        } //if ( !request )
+
+        Busy.insert(fd);
+        auto& connection = *Connections.at(fd);
+        pool.submit([this, fd, &connection, request = std::move(*request)](void) mutable noexcept {
+            const bool open = serveRequest(connection, request, Part, Manifest, Cache);
+            {
+                std::lock_guard lock{Mutex};
+                Returned.emplace_back(fd, open);
+            }
+            //Ist die Pipe voll, wacht der Listener ohnehin auf.
+            [[maybe_unused]] const auto written = ::write(WakeUp[1], "", 1);
+            return;
+        });
+        return;
+    }
+
+    void takeBack(ThreadPool& pool) {
+        std::array<char, 64> drain;
+        while ( ::read(WakeUp[0], drain.data(), drain.size()) > 0 ) {
+        } //while ( ::read(WakeUp[0], drain.data(), drain.size()) > 0 )
+
+        std::vector<std::pair<int, bool>> returned;
+        {
+            std::lock_guard lock{Mutex};
+            returned.swap(Returned);
+        }
+
+        for ( auto [fd, open] : returned ) {
+            Busy.erase(fd);
+            if ( !open ) {
+                Connections.erase(fd);
+            } //if ( !open )
+            else {
+                //Die nächste Anfrage kann schon gelesen sein, poll würde sie nicht mehr melden.
+                serveNext(fd, pool);
+            } //else -> if ( !open )
+        } //for ( auto [fd, open] : returned )
+        return;
+    }
+};
+} //namespace
+
+int runServer(const std::filesystem::path& socketPath, std::size_t jobs, int part, const AnswerManifest& manifest) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if ( socketPath.native().size() >= sizeof(address.sun_path) ) {
+        myErr("Socket path {:s} is too long!\n", socketPath.native());
+        return -1;
+    } //if ( socketPath.native().size() >= sizeof(address.sun_path) )
+    std::ranges::copy(socketPath.native(), address.sun_path);
+
+    //Nicht blockierend, falls die Verbindung zwischen poll und accept schon wieder weg ist.
+    const int listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if ( listenFd < 0 ) {
+        myErr("Could not create socket: {:s}\n", std::strerror(errno));
+        return -2;
+    } //if ( listenFd < 0 )
+
+    //Ein alter Socket von einem abgebrochenen Lauf würde das bind verhindern.
+    ::unlink(socketPath.c_str());
+    if ( ::bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+         ::listen(listenFd, SOMAXCONN) != 0 ) {
+        myErr("Could not listen on {:s}: {:s}\n", socketPath.native(), std::strerror(errno));
+        ::close(listenFd);
+        return -2;
+    } //if ( ::bind(...) != 0 || ::listen(listenFd, SOMAXCONN) != 0 )
+
+    //Ohne SA_RESTART kommt poll mit EINTR zurück, dann wird die Schleife beendet.
+    struct sigaction action{};
+    action.sa_handler = requestStop;
+    ::sigaction(SIGINT, &action, nullptr);
+    ::sigaction(SIGTERM, &action, nullptr);
+
+    myPrint(" == Listening on {:s} ==\n", socketPath.native());
+    myFlush();
+
+    {
+        ResultCache   cache;
+        ConnectionSet connections{part, manifest, cache};
+        if ( !connections.valid() ) {
+            myErr("Could not create pipe: {:s}\n", std::strerror(errno));
+            ::close(listenFd);
+            ::unlink(socketPath.c_str());
+            return -2;
+        } //if ( !connections.valid() )
+
+        //Die Signale sollen nur im ppoll ankommen, nicht in einem Worker, die erben die Maske beim Erzeugen. Und nicht
+        //zwischen der Prüfung auf StopRequested und dem Warten.
+        sigset_t signals;
+        sigset_t waitSignals;
+        ::sigemptyset(&signals);
+        ::sigaddset(&signals, SIGINT);
+        ::sigaddset(&signals, SIGTERM);
+        ::pthread_sigmask(SIG_BLOCK, &signals, &waitSignals);
+
+        ThreadPool pool{std::max(jobs, 1uz)};
+
+        while ( !StopRequested ) {
+            if ( !connections.poll(listenFd, pool, waitSignals) ) {
+                continue;
+            } //if ( !connections.poll(listenFd, pool, waitSignals) )
+
+            const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+            if ( fd < 0 ) {
+                if ( errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK ) {
+                    myErr("Accept failed: {:s}\n", std::strerror(errno));
+                } //if ( errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK )
+                continue;
+            } //if ( fd < 0 )
+            connections.add(fd);
+        } //while ( !StopRequested )
+
+        //Laufende Anfragen werden noch beantwortet, danach werden alle Verbindungen geschlossen.
+        ::close(listenFd);
+        ::unlink(socketPath.c_str());
+        pool.wait();
+        ::pthread_sigmask(SIG_SETMASK, &waitSignals, nullptr);
+    }
+
+    myPrint(" == Server stopped ==\n");
+    return 0;
+}
@@ -0,0 +1,26 @@
+#ifndef SERVER_HPP
+#define SERVER_HPP
+
+#include <cstddef>
+#include <filesystem>
+
+class AnswerManifest;
+
+/**
+ * @brief Bleibt resident und löst Challenges, die über einen Unix Domain Socket angefragt werden.
+ *
+ * Eine Anfrage ist eine Zeile "challenge bytes\n", gefolgt von genau bytes Bytes Eingabe. Die Antwort ist eine JSON
+ * Zeile wie im Batch. Über eine Verbindung können beliebig viele Anfragen nacheinander gestellt werden. Ergebnisse
+ * werden nach Challenge und Hash der Eingabe zwischengespeichert.
+ *
+ * Eingaben sind auf 4 MiB begrenzt. Jede Anfrage ist eine eigene Aufgabe im Pool, sobald sie vollständig gelesen ist.
+ * Eine offene Verbindung ohne oder mit halber Anfrage belegt keinen Worker.
+ *
+ * Läuft bis SIGINT oder SIGTERM, danach werden laufende Anfragen noch beantwortet und der Socket wieder entfernt.
+ * @param[in] jobs Wie viele Anfragen gleichzeitig bearbeitet werden.
+ * @param[in] part 0 für beide Teile, sonst nur der angegebene.
+ * @return Der Exitcode.
+ */
+int runServer(const std::filesystem::path& socketPath, std::size_t jobs, int part, const AnswerManifest& manifest);
+
+#endif //SERVER_HPP
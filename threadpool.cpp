@@ -0,0 +1,126 @@
+#include "threadpool.hpp"
+
+#include <algorithm>
+
+namespace {
+thread_local ThreadPool* CurrentPool  = nullptr;
+thread_local std::size_t CurrentIndex = 0;
+
+std::atomic_size_t ChallengeJobs{1};
+} //namespace
+
+std::size_t challengeJobs(void) noexcept {
+    return ChallengeJobs.load(std::memory_order_relaxed);
+}
+
+void setChallengeJobs(std::size_t jobs) noexcept {
+    ChallengeJobs.store(std::max(jobs, 1uz), std::memory_order_relaxed);
+    return;
+}
+
+ThreadPool::ThreadPool(std::size_t numberOfThreads) {
+    numberOfThreads = std::max(numberOfThreads, 1uz);
+    Queues.reserve(numberOfThreads);
+    for ( std::size_t i = 0; i < numberOfThreads; ++i ) {
+        Queues.push_back(std::make_unique<Queue>());
+    } //for ( std::size_t i = 0; i < numberOfThreads; ++i )
+
+    Threads.reserve(numberOfThreads);
+    for ( std::size_t i = 0; i < numberOfThreads; ++i ) {
+        Threads.emplace_back([this, i](void) { work(i); });
+    } //for ( std::size_t i = 0; i < numberOfThreads; ++i )
+    return;
+}
+
+ThreadPool::~ThreadPool(void) {
+    {
+        std::lock_guard lock{Mutex};
+        Stop = true;
+    }
+    WorkAvailable.notify_all();
+    //Explizit, von selbst würden die jthreads erst nach Mutex und den Condition Variables joinen.
+    for ( auto& thread : Threads ) {
+        thread.join();
+    } //for ( auto& thread : Threads )
+    return;
+}
+
+void ThreadPool::submit(Task task) {
+    const auto index = CurrentPool == this ? CurrentIndex : NextQueue++ % Queues.size();
+
+    {
+        auto&           queue = *Queues[index];
+        std::lock_guard lock{queue.Mutex};
+        queue.Tasks.push_back(std::move(task));
+    }
+
+    {
+        std::lock_guard lock{Mutex};
+        ++Queued;
+    }
+    WorkAvailable.notify_one();
+    return;
+}
+
+void ThreadPool::wait(void) {
+    std::unique_lock lock{Mutex};
+    AllDone.wait(lock, [this](void) noexcept { return Queued == 0 && Running == 0; });
+    return;
+}
+
+bool ThreadPool::takeTask(std::size_t index, Task& task) {
+    {
+        //Die eigene Queue von hinten, das ist vermutlich noch warm im Cache.
+        auto&           queue = *Queues[index];
+        std::lock_guard lock{queue.Mutex};
+        if ( !queue.Tasks.empty() ) {
+            task = std::move(queue.Tasks.back());
+            queue.Tasks.pop_back();
+            return true;
+        } //if ( !queue.Tasks.empty() )
+    }
+
+    for ( std::size_t offset = 1; offset < Queues.size(); ++offset ) {
+        //Klauen von vorne, das ist am längsten liegen geblieben.
+        auto&           queue = *Queues[(index + offset) % Queues.size()];
+        std::lock_guard lock{queue.Mutex};
+        if ( !queue.Tasks.empty() ) {
+            task = std::move(queue.Tasks.front());
+            queue.Tasks.pop_front();
+            return true;
+        } //if ( !queue.Tasks.empty() )
+    } //for ( std::size_t offset = 1; offset < Queues.size(); ++offset )
+    return false;
+}
+
+void ThreadPool::work(std::size_t index) {
+    CurrentPool  = this;
+    CurrentIndex = index;
+
+    for ( ;; ) {
+        {
+            std::unique_lock lock{Mutex};
+            WorkAvailable.wait(lock, [this](void) noexcept { return Stop || Queued > 0; });
+            if ( Queued == 0 ) {
+                //Stop und nichts mehr zu tun.
+                return;
+            } //if ( Queued == 0 )
+            --Queued;
+            ++Running;
+        }
+
+        //Wir haben uns eine Aufgabe reserviert, die liegt garantiert in irgendeiner Queue.
+        Task task;
+        while ( !takeTask(index, task) ) {
+            std::this_thread::yield();
+        } //while ( !takeTask(index, task) )
+        task();
+
+        {
+            std::lock_guard lock{Mutex};
+            if ( --Running == 0 && Queued == 0 ) {
+                AllDone.notify_all();
+            } //if ( --Running == 0 && Queued == 0 )
+        }
+    } //for ( ;; )
+}
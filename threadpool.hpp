@@ -0,0 +1,71 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Ein einfacher Threadpool, bei dem sich jeder Worker eine eigene Queue hat und sich bei Bedarf Arbeit von den
+ * anderen klaut.
+ */
+class ThreadPool {
+    public:
+    using Task = std::function<void(void)>;
+
+    explicit ThreadPool(std::size_t numberOfThreads);
+    ~ThreadPool(void);
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size(void) const noexcept {
+        return Queues.size();
+    }
+
+    /**
+     * @brief Reiht eine Aufgabe ein. Aus einem Worker heraus landet sie in dessen eigener Queue, sonst reihum.
+     * @note Die Aufgabe darf keine Exception werfen.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Wartet bis alle eingereihten Aufgaben abgearbeitet sind.
+     */
+    void wait(void);
+
+    private:
+    struct Queue {
+        std::mutex       Mutex;
+        std::deque<Task> Tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> Queues;
+    std::vector<std::jthread>           Threads;
+    std::mutex                          Mutex;
+    std::condition_variable             WorkAvailable;
+    std::condition_variable             AllDone;
+    std::size_t                         Queued  = 0;
+    std::size_t                         Running = 0;
+    std::atomic_size_t                  NextQueue{0};
+    bool                                Stop = false;
+
+    void work(std::size_t index);
+    bool takeTask(std::size_t index, Task& task);
+};
+
+/**
+ * @brief Wie viele Threads eine Challenge selbst nutzen darf, um einen einzelnen Teil zu beschleunigen.
+ *
+ * Der Treiber teilt --jobs auf die gleichzeitig laufenden Challenges auf, ohne Vorgabe ist es 1.
+ */
+std::size_t challengeJobs(void) noexcept;
+void        setChallengeJobs(std::size_t jobs) noexcept;
+
+#endif //THREADPOOL_HPP